@@ -0,0 +1,105 @@
+AR = ['/usr/bin/ar']
+ARFLAGS = ['rcs']
+BINDIR = '/usr/local/bin'
+BOOST_VERSION = '1_74'
+BOOST_VERSION_NUMBER = 107400
+BUILD = 'linux'
+CC_VERSION = ('12', '2', '0')
+COMPILER_CXX = 'g++'
+CPPPATH_ST = '-I%s'
+CXX = ['/usr/bin/g++']
+CXXFLAGS = ['-Og', '-g3', '-pedantic', '-Wall', '-Wextra', '-Werror', '-Wcatch-value=2', '-Wextra-semi', '-Wnon-virtual-dtor', '-Wno-error=deprecated-declarations', '-Wno-error=maybe-uninitialized', '-Wno-unused-parameter', '-fdiagnostics-color', '-Wredundant-tags', '-std=c++14']
+CXXFLAGS_BOOST = ['']
+CXXFLAGS_MACBUNDLE = ['-fPIC']
+CXXFLAGS_cxxshlib = ['-fPIC']
+CXXLNK_SRC_F = []
+CXXLNK_TGT_F = ['-o']
+CXXPCH_EXT = '.gch'
+CXXPCH_F = ['-include']
+CXXPCH_FLAGS = ['-x', 'c++-header']
+CXX_NAME = 'gcc'
+CXX_SRC_F = []
+CXX_TGT_F = ['-c', '-o']
+DATADIR = '/usr/local/share'
+DATAROOTDIR = '/usr/local/share'
+DEFINES = ['_DEBUG']
+DEFINES_BOOST = ['BOOST_STACKTRACE_DYN_LINK', 'BOOST_LOG_DYN_LINK', 'BOOST_FILESYSTEM_NO_DEPRECATED']
+DEFINES_ST = '-D%s'
+DEFINE_COMMENTS = {'HAVE_STD_TO_STRING': '', 'HAVE_ATOMIC': '', 'HAVE_PTHREAD': '', 'HAVE_RT': '', 'HAVE_GETPASS': '', 'HAVE_NETLINK': '', 'HAVE_NETLINK_EXT_ACK': '', 'HAVE_IFA_FLAGS': '', 'HAVE_SQLITE3': '', 'HAVE_OPENSSL': '', 'HAVE_STACKTRACE': '', 'HAVE_TESTS': '', 'WITH_OSX_KEYCHAIN': '', 'DISABLE_SQLITE3_FS_LOCKING': '', 'SYSCONFDIR': ''}
+DEST_BINFMT = 'elf'
+DEST_CPU = 'x86_64'
+DEST_OS = 'linux'
+DOCDIR = '/usr/local/share/doc/ndn-cxx'
+DONE_FIND_BOOST_COMMON = True
+DPKG_ARCHITECTURE = ['/usr/bin/dpkg-architecture']
+DVIDIR = '/usr/local/share/doc/ndn-cxx'
+EXEC_PREFIX = '/usr/local'
+HAVE_ATOMIC = 1
+HAVE_GETPASS = 1
+HAVE_IFA_FLAGS = 1
+HAVE_LINUX_IF_ADDR_H = 1
+HAVE_NETLINK = True
+HAVE_NETLINK_EXT_ACK = 1
+HAVE_OPENSSL = 1
+HAVE_PTHREAD = 1
+HAVE_RT = 1
+HAVE_SQLITE3 = 1
+HAVE_STACKTRACE = True
+HOST = 'linux'
+HTMLDIR = '/usr/local/share/doc/ndn-cxx'
+INCLUDEDIR = '/usr/local/include'
+INCLUDES_BOOST = '/usr/include'
+INCLUDES_OPENSSL = ['/usr/include']
+INFODIR = '/usr/local/share/info'
+LIBDIR = '/usr/local/lib64'
+LIBEXECDIR = '/usr/local/libexec'
+LIBPATH_BOOST = ['/usr/lib/x86_64-linux-gnu']
+LIBPATH_OPENSSL = ['/usr/lib']
+LIBPATH_ST = '-L%s'
+LIB_ATOMIC = ['atomic']
+LIB_BOOST = ['boost_system', 'boost_program_options', 'boost_chrono', 'boost_date_time', 'boost_filesystem', 'boost_thread', 'boost_log', 'boost_stacktrace_backtrace', 'boost_unit_test_framework']
+LIB_OPENSSL = ['crypto']
+LIB_PTHREAD = ['pthread']
+LIB_RT = ['rt']
+LIB_SQLITE3 = ['sqlite3']
+LIB_ST = '-l%s'
+LINKFLAGS = ['-Wl,-O1', '-fuse-ld=gold']
+LINKFLAGS_BOOST = ['']
+LINKFLAGS_MACBUNDLE = ['-bundle', '-undefined', 'dynamic_lookup']
+LINKFLAGS_cxxshlib = ['-shared']
+LINKFLAGS_cxxstlib = ['-Wl,-Bstatic']
+LINK_CXX = ['/usr/bin/g++']
+LOCALEDIR = '/usr/local/share/locale'
+LOCALSTATEDIR = '/usr/local/var'
+MANDIR = '/usr/local/share/man'
+OLDINCLUDEDIR = '/usr/include'
+PACKAGE = 'ndn-cxx'
+PDFDIR = '/usr/local/share/doc/ndn-cxx'
+PKGCONFIG = ['/usr/bin/pkg-config']
+PREFIX = '/usr/local'
+PSDIR = '/usr/local/share/doc/ndn-cxx'
+RPATH_ST = '-Wl,-rpath,%s'
+SBINDIR = '/usr/local/sbin'
+SHAREDSTATEDIR = '/usr/local/com'
+SHLIB_MARKER = '-Wl,-Bdynamic'
+SONAME_ST = '-Wl,-h,%s'
+STLIBPATH = ['.']
+STLIBPATH_BOOST = ['/usr/lib/x86_64-linux-gnu']
+STLIBPATH_ST = '-L%s'
+STLIB_BOOST = []
+STLIB_MARKER = '-Wl,-Bstatic'
+STLIB_ST = '-l%s'
+SYSCONFDIR = '/usr/local/etc'
+TAR = ['/usr/bin/tar']
+WITH_EXAMPLES = False
+WITH_PCH = True
+WITH_TESTS = True
+WITH_TOOLS = False
+cfg_files = ['/root/repo/build/ndn-cxx/detail/config.hpp']
+cxxprogram_PATTERN = '%s'
+cxxshlib_PATTERN = 'lib%s.so'
+cxxstlib_PATTERN = 'lib%s.a'
+define_key = []
+enable_shared = True
+enable_static = False
+macbundle_PATTERN = '%s.bundle'
@@ -0,0 +1,2 @@
+version = 0x2001700
+tools = [{'tool': 'cross', 'tooldir': None, 'funs': None}, {'tool': 'ar', 'tooldir': None, 'funs': None}, {'tool': 'cxx', 'tooldir': None, 'funs': None}, {'tool': 'g++', 'tooldir': None, 'funs': None}, {'tool': 'compiler_cxx', 'tooldir': None, 'funs': None}, {'tool': 'gnu_dirs', 'tooldir': None, 'funs': None}, {'tool': 'c_osx', 'tooldir': None, 'funs': None}, {'tool': 'default-compiler-flags', 'tooldir': None, 'funs': None}, {'tool': 'compiler-features', 'tooldir': None, 'funs': None}, {'tool': 'pch', 'tooldir': None, 'funs': None}, {'tool': 'osx-frameworks', 'tooldir': None, 'funs': None}, {'tool': 'boost', 'tooldir': None, 'funs': None}, {'tool': 'openssl', 'tooldir': None, 'funs': None}, {'tool': 'sqlite3', 'tooldir': None, 'funs': None}, {'tool': 'doxygen', 'tooldir': None, 'funs': None}, {'tool': 'sphinx_build', 'tooldir': None, 'funs': None}, {'tool': 'coverage', 'tooldir': None, 'funs': None}, {'tool': 'sanitizers', 'tooldir': None, 'funs': None}]
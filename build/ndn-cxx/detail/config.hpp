@@ -0,0 +1,22 @@
+/* WARNING! All changes made to this file will be lost! */
+
+#ifndef W_NDN_CXX_DETAIL_CONFIG_HPP_WAF
+#define W_NDN_CXX_DETAIL_CONFIG_HPP_WAF
+
+#define NDN_CXX_HAVE_STD_TO_STRING 1
+#define NDN_CXX_HAVE_ATOMIC 1
+#define NDN_CXX_HAVE_PTHREAD 1
+#define NDN_CXX_HAVE_RT 1
+#define NDN_CXX_HAVE_GETPASS 1
+#define NDN_CXX_HAVE_NETLINK 1
+#define NDN_CXX_HAVE_NETLINK_EXT_ACK 1
+#define NDN_CXX_HAVE_IFA_FLAGS 1
+#define NDN_CXX_HAVE_SQLITE3 1
+#define NDN_CXX_HAVE_OPENSSL 1
+#define NDN_CXX_HAVE_STACKTRACE 1
+#define NDN_CXX_HAVE_TESTS 1
+/* #undef NDN_CXX_WITH_OSX_KEYCHAIN */
+/* #undef NDN_CXX_DISABLE_SQLITE3_FS_LOCKING */
+#define NDN_CXX_SYSCONFDIR "/usr/local/etc"
+
+#endif /* W_NDN_CXX_DETAIL_CONFIG_HPP_WAF */
@@ -0,0 +1,193 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/compact-name.hpp"
+#include "ndn-cxx/encoding/block-helpers.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <cstring>
+
+namespace ndn {
+
+constexpr size_t CompactName::INLINE_CAPACITY;
+
+CompactName::CompactName(const Name& name)
+{
+  const Block& wire = name.wireEncode();
+  if (name.size() > std::numeric_limits<uint16_t>::max() ||
+      wire.value_size() > std::numeric_limits<uint16_t>::max()) {
+    NDN_THROW(std::length_error("Name is too long to be stored in CompactName"));
+  }
+
+  uint8_t* storage = allocate(name.size(), wire.value_size());
+  uint16_t offset = 0;
+  for (size_t i = 0; i < name.size(); ++i) {
+    offset += static_cast<uint16_t>(name[i].size());
+    std::memcpy(storage + i * sizeof(uint16_t), &offset, sizeof(uint16_t));
+  }
+  std::copy(wire.value_begin(), wire.value_end(), storage + getOffsetTableSize());
+}
+
+CompactName::CompactName(const CompactName& other)
+{
+  uint8_t* storage = allocate(other.m_nComponents, other.m_valueSize);
+  std::memcpy(storage, other.getStorage(), other.getStorageSize());
+}
+
+CompactName::CompactName(CompactName&& other) noexcept
+  : m_nComponents(other.m_nComponents)
+  , m_valueSize(other.m_valueSize)
+{
+  if (isInline()) {
+    std::memcpy(m_inline, other.m_inline, getStorageSize());
+  }
+  else {
+    m_heap = other.m_heap;
+  }
+  other.m_nComponents = other.m_valueSize = 0;
+}
+
+CompactName&
+CompactName::operator=(const CompactName& other)
+{
+  // copy first, so that this name is left unchanged if the allocation fails
+  CompactName copy(other);
+  return *this = std::move(copy);
+}
+
+CompactName&
+CompactName::operator=(CompactName&& other) noexcept
+{
+  if (this != &other) {
+    deallocate();
+    m_nComponents = other.m_nComponents;
+    m_valueSize = other.m_valueSize;
+    if (isInline()) {
+      std::memcpy(m_inline, other.m_inline, getStorageSize());
+    }
+    else {
+      m_heap = other.m_heap;
+    }
+    other.m_nComponents = other.m_valueSize = 0;
+  }
+  return *this;
+}
+
+CompactName::~CompactName()
+{
+  deallocate();
+}
+
+uint8_t*
+CompactName::allocate(size_t nComponents, size_t valueSize)
+{
+  m_nComponents = static_cast<uint16_t>(nComponents);
+  m_valueSize = static_cast<uint16_t>(valueSize);
+  if (isInline()) {
+    return m_inline;
+  }
+  m_heap = new uint8_t[getStorageSize()];
+  return m_heap;
+}
+
+void
+CompactName::deallocate() noexcept
+{
+  if (!isInline()) {
+    delete[] m_heap;
+  }
+  m_nComponents = m_valueSize = 0;
+}
+
+Name
+CompactName::toName() const
+{
+  return Name(wireEncode());
+}
+
+Block
+CompactName::wireEncode() const
+{
+  return makeBinaryBlock(tlv::Name, getValue());
+}
+
+size_t
+CompactName::getEndOffset(size_t i) const noexcept
+{
+  BOOST_ASSERT(i < m_nComponents);
+  uint16_t offset = 0;
+  std::memcpy(&offset, getStorage() + i * sizeof(uint16_t), sizeof(uint16_t));
+  return offset;
+}
+
+span<const uint8_t>
+CompactName::getComponentWire(size_t i) const noexcept
+{
+  size_t begin = i == 0 ? 0 : getEndOffset(i - 1);
+  size_t end = getEndOffset(i);
+  return getValue().subspan(begin, end - begin);
+}
+
+bool
+CompactName::isPrefixOf(const CompactName& other) const noexcept
+{
+  if (m_nComponents > other.m_nComponents) {
+    return false;
+  }
+  if (empty()) {
+    return true;
+  }
+  return other.getEndOffset(m_nComponents - 1) == m_valueSize &&
+         std::equal(getValue().begin(), getValue().end(), other.getValue().begin());
+}
+
+int
+CompactName::compare(const CompactName& other) const noexcept
+{
+  size_t count = std::min(size(), other.size());
+  for (size_t i = 0; i < count; ++i) {
+    // lexical order of the TLV encoding is the same as the canonical order of name components
+    auto lhs = getComponentWire(i);
+    auto rhs = other.getComponentWire(i);
+    int cmp = std::memcmp(lhs.data(), rhs.data(), std::min(lhs.size(), rhs.size()));
+    if (cmp != 0) {
+      return cmp;
+    }
+    if (lhs.size() != rhs.size()) {
+      return lhs.size() < rhs.size() ? -1 : 1;
+    }
+  }
+  return static_cast<int>(size()) - static_cast<int>(other.size());
+}
+
+} // namespace ndn
+
+namespace std {
+
+size_t
+hash<ndn::CompactName>::operator()(const ndn::CompactName& name) const
+{
+  auto value = name.getValue();
+  return boost::hash_range(value.begin(), value.end());
+}
+
+} // namespace std
@@ -0,0 +1,248 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_COMPACT_NAME_HPP
+#define NDN_CXX_COMPACT_NAME_HPP
+
+#include "ndn-cxx/name.hpp"
+
+namespace ndn {
+
+/** @brief Memory-efficient immutable storage for a Name
+ *
+ *  A Name keeps one Block per name component, each holding a reference to the underlying wire
+ *  buffer. CompactName instead stores the concatenated component TLVs (i.e., the TLV-VALUE of
+ *  the Name element) in one contiguous byte array, preceded by a table of component end offsets.
+ *  When the offset table and the bytes together fit in INLINE_CAPACITY octets, they are stored
+ *  within the object itself and no heap allocation is made.
+ *
+ *  CompactName is meant for holding large numbers of names, such as the keys of a cache.
+ *  It supports equality, canonical ordering, prefix tests, and hashing without converting back
+ *  to Name; toName() restores a full Name when the complete API is needed.
+ */
+class CompactName
+{
+public:
+  /** @brief Maximum number of octets (offset table and components) stored inline
+   */
+  static constexpr size_t INLINE_CAPACITY = 128;
+
+  /** @brief Create an empty name
+   */
+  CompactName() noexcept
+  {
+  }
+
+  /** @brief Create from a Name
+   *  @throw std::length_error the name is too long to be represented
+   */
+  explicit
+  CompactName(const Name& name);
+
+  CompactName(const CompactName& other);
+
+  CompactName(CompactName&& other) noexcept;
+
+  CompactName&
+  operator=(const CompactName& other);
+
+  CompactName&
+  operator=(CompactName&& other) noexcept;
+
+  ~CompactName();
+
+  /** @brief Convert to Name
+   */
+  Name
+  toName() const;
+
+  /** @brief Return the wire encoding of the Name element
+   */
+  Block
+  wireEncode() const;
+
+public: // accessors
+  /** @brief Check if name is empty
+   */
+  NDN_CXX_NODISCARD bool
+  empty() const noexcept
+  {
+    return m_nComponents == 0;
+  }
+
+  /** @brief Return the number of name components
+   */
+  size_t
+  size() const noexcept
+  {
+    return m_nComponents;
+  }
+
+  /** @brief Return the wire encoding of the i-th name component
+   *  @pre `i < size()`
+   */
+  span<const uint8_t>
+  getComponentWire(size_t i) const noexcept;
+
+  /** @brief Return a copy of the i-th name component
+   *  @pre `i < size()`
+   */
+  name::Component
+  get(size_t i) const
+  {
+    return name::Component(Block(getComponentWire(i)));
+  }
+
+  /** @brief Return the concatenated wire encoding of all name components
+   *
+   *  This is the TLV-VALUE of the Name element.
+   */
+  span<const uint8_t>
+  getValue() const noexcept
+  {
+    return {getStorage() + getOffsetTableSize(), m_valueSize};
+  }
+
+  /** @brief Check if the bytes are stored within the object, without heap allocation
+   */
+  bool
+  isInline() const noexcept
+  {
+    return getStorageSize() <= INLINE_CAPACITY;
+  }
+
+public: // comparison
+  /** @brief Check if this name is a prefix of another name
+   */
+  bool
+  isPrefixOf(const CompactName& other) const noexcept;
+
+  /** @brief Compare this to the other name using NDN canonical ordering
+   *  @return the same as Name::compare() on the equivalent names
+   */
+  int
+  compare(const CompactName& other) const noexcept;
+
+private: // non-member operators
+  // NOTE: the following "hidden friend" operators are available via
+  //       argument-dependent lookup only and must be defined inline.
+
+  friend bool
+  operator==(const CompactName& lhs, const CompactName& rhs) noexcept
+  {
+    return lhs.m_nComponents == rhs.m_nComponents && lhs.m_valueSize == rhs.m_valueSize &&
+           std::equal(lhs.getValue().begin(), lhs.getValue().end(), rhs.getValue().begin());
+  }
+
+  friend bool
+  operator!=(const CompactName& lhs, const CompactName& rhs) noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+  friend bool
+  operator<(const CompactName& lhs, const CompactName& rhs) noexcept
+  {
+    return lhs.compare(rhs) < 0;
+  }
+
+  friend bool
+  operator<=(const CompactName& lhs, const CompactName& rhs) noexcept
+  {
+    return lhs.compare(rhs) <= 0;
+  }
+
+  friend bool
+  operator>(const CompactName& lhs, const CompactName& rhs) noexcept
+  {
+    return lhs.compare(rhs) > 0;
+  }
+
+  friend bool
+  operator>=(const CompactName& lhs, const CompactName& rhs) noexcept
+  {
+    return lhs.compare(rhs) >= 0;
+  }
+
+  /** @brief Print the URI representation of a name.
+   */
+  friend std::ostream&
+  operator<<(std::ostream& os, const CompactName& name)
+  {
+    return os << name.toName();
+  }
+
+private:
+  size_t
+  getOffsetTableSize() const noexcept
+  {
+    return m_nComponents * sizeof(uint16_t);
+  }
+
+  size_t
+  getStorageSize() const noexcept
+  {
+    return getOffsetTableSize() + m_valueSize;
+  }
+
+  const uint8_t*
+  getStorage() const noexcept
+  {
+    return isInline() ? m_inline : m_heap;
+  }
+
+  /** @brief Return the end offset of the i-th component within getValue()
+   */
+  size_t
+  getEndOffset(size_t i) const noexcept;
+
+  /** @brief Allocate storage for a name with the given dimensions
+   *  @pre storage has not been allocated
+   */
+  uint8_t*
+  allocate(size_t nComponents, size_t valueSize);
+
+  void
+  deallocate() noexcept;
+
+private:
+  union {
+    uint8_t m_inline[INLINE_CAPACITY];
+    uint8_t* m_heap;
+  };
+  uint16_t m_nComponents = 0;
+  uint16_t m_valueSize = 0;
+};
+
+} // namespace ndn
+
+namespace std {
+
+template<>
+struct hash<ndn::CompactName>
+{
+  size_t
+  operator()(const ndn::CompactName& name) const;
+};
+
+} // namespace std
+
+#endif // NDN_CXX_COMPACT_NAME_HPP
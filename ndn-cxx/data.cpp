@@ -93,6 +93,24 @@ Data::wireEncode<encoding::EstimatorTag>(EncodingEstimator&, bool) const;
 const Block&
 Data::wireEncode(EncodingBuffer& encoder, span<const uint8_t> signature) const
 {
+  finalizeEncoding(encoder, signature);
+  const_cast<Data*>(this)->wireDecode(encoder.block());
+  return m_wire;
+}
+
+void
+Data::finalizeEncoding(EncodingBuffer& encoder, span<const uint8_t> signature)
+{
+  size_t sigValueSize = tlv::sizeOfVarNumber(tlv::SignatureValue) +
+                        tlv::sizeOfVarNumber(signature.size()) + signature.size();
+  size_t valueSize = encoder.size() + sigValueSize;
+  size_t headerSize = tlv::sizeOfVarNumber(tlv::Data) + tlv::sizeOfVarNumber(valueSize);
+  // the Data would keep the whole underlying buffer alive, e.g., the default-sized
+  // buffer of an EncodingBuffer, so reallocate it if it's mostly unused
+  if (encoder.capacity() > 2 * (headerSize + valueSize)) {
+    encoder.shrinkToFit(headerSize, sigValueSize);
+  }
+
   size_t totalLength = encoder.size();
   totalLength += encoder.appendVarNumber(tlv::SignatureValue);
   totalLength += encoder.appendVarNumber(signature.size());
@@ -100,8 +118,24 @@ Data::wireEncode(EncodingBuffer& encoder, span<const uint8_t> signature) const
 
   encoder.prependVarNumber(totalLength);
   encoder.prependVarNumber(tlv::Data);
+}
 
-  const_cast<Data*>(this)->wireDecode(encoder.block());
+const Block&
+Data::wireEncodeSigned(EncodingBuffer& encoder, span<const uint8_t> signature)
+{
+  finalizeEncoding(encoder, signature);
+
+  // The other fields already hold what was just encoded, so instead of decoding the whole
+  // packet again, only refer the Content and SignatureValue elements to the new wire encoding.
+  m_wire = encoder.block();
+  m_wire.parse();
+  BOOST_ASSERT(m_wire.elements().front() == m_name.wireEncode());
+  BOOST_ASSERT(SignatureInfo(m_wire.get(tlv::SignatureInfo)) == m_signatureInfo);
+  m_signatureValue = m_wire.elements().back();
+  if (hasContent()) {
+    m_content = m_wire.get(tlv::Content);
+  }
+  m_fullName.clear();
   return m_wire;
 }
 
@@ -210,8 +244,10 @@ Data::getFullName() const
     if (!m_wire.hasWire()) {
       NDN_THROW(Error("Cannot compute full name because Data has no wire encoding (not signed)"));
     }
+    util::Sha256::Digest digest;
+    util::Sha256::computeDigest(m_wire, digest);
     m_fullName = m_name;
-    m_fullName.appendImplicitSha256Digest(util::Sha256::computeDigest(m_wire));
+    m_fullName.appendImplicitSha256Digest(digest);
   }
 
   return m_fullName;
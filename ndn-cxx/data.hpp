@@ -31,6 +31,12 @@
 
 namespace ndn {
 
+namespace security {
+inline namespace v2 {
+class KeyChain;
+} // inline namespace v2
+} // namespace security
+
 /** @brief Represents a %Data packet.
  *  @sa https://named-data.net/doc/NDN-packet-spec/0.3/data.html
  */
@@ -90,6 +96,9 @@ public:
    * auto signature = create_signature_over_signed_portion(encoder.data(), encoder.size());
    * data.wireEncode(encoder, signature);
    * @endcode
+   *
+   * If most of the encoder's underlying buffer would be left unused, the encoding is moved into
+   * a smaller buffer, so that the Data does not keep the oversized buffer alive.
    */
   const Block&
   wireEncode(EncodingBuffer& encoder, span<const uint8_t> signature) const;
@@ -338,6 +347,20 @@ protected:
   void
   resetWire();
 
+private:
+  /** @brief Append @p signature to the unsigned portion in @p encoder and add the outer TLV header
+   */
+  static void
+  finalizeEncoding(EncodingBuffer& encoder, span<const uint8_t> signature);
+
+  /** @brief Finalize the encoding like wireEncode(EncodingBuffer&, span<const uint8_t>) const,
+   *         but without decoding the resulting packet again
+   *  @pre @p encoder contains the unsigned portion of this Data, as produced by
+   *       `wireEncode(encoder, true)`, and the Data has not been modified since.
+   */
+  const Block&
+  wireEncodeSigned(EncodingBuffer& encoder, span<const uint8_t> signature);
+
 private:
   Name m_name;
   MetaInfo m_metaInfo;
@@ -347,6 +370,8 @@ private:
 
   mutable Block m_wire;
   mutable Name m_fullName; // cached FullName computed from m_wire
+
+  friend security::KeyChain;
 };
 
 #ifndef DOXYGEN
@@ -94,6 +94,18 @@ Encoder::reserve(size_t size, bool addInFront)
   }
 }
 
+void
+Encoder::shrinkToFit(size_t reserveFront, size_t reserveBack)
+{
+  size_t length = size();
+  auto buf = make_shared<Buffer>(reserveFront + length + reserveBack);
+  std::copy(m_begin, m_end, buf->begin() + reserveFront);
+
+  m_buffer = std::move(buf);
+  m_begin = m_buffer->begin() + reserveFront;
+  m_end = m_begin + length;
+}
+
 size_t
 Encoder::prependBytes(span<const uint8_t> bytes)
 {
@@ -145,6 +145,18 @@ public: // unique interface to the Encoder
   void
   reserveFront(size_t size);
 
+  /**
+   * @brief Reallocate the underlying buffer to fit the encoded bytes
+   * @param reserveFront number of bytes to leave available for subsequent prepend* operations
+   * @param reserveBack number of bytes to leave available for subsequent append* operations
+   *
+   * Blocks created from the encoder share the whole underlying buffer. Calling this method
+   * before creating a long-lived Block avoids keeping a mostly unused buffer alive, at the
+   * cost of one copy of the encoded bytes.
+   */
+  void
+  shrinkToFit(size_t reserveFront = 0, size_t reserveBack = 0);
+
   /**
    * @brief Get size of the underlying buffer
    */
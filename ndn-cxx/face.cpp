@@ -208,6 +208,43 @@ Face::put(lp::Nack nack)
   } IO_CAPTURE_WEAK_IMPL_END
 }
 
+void
+Face::enableSubmissionQueue(size_t capacity)
+{
+  BOOST_ASSERT(m_impl->m_submissionQueue == nullptr);
+  m_impl->m_submissionQueue = make_unique<detail::MpscQueue<Impl::Submission>>(capacity);
+}
+
+bool
+Face::submitInterest(const Interest& interest,
+                     const DataCallback& afterSatisfied,
+                     const NackCallback& afterNacked,
+                     const TimeoutCallback& afterTimeout)
+{
+  auto interest2 = make_shared<Interest>(interest);
+  interest2->getNonce();
+
+  return m_impl->submit({std::move(interest2), afterSatisfied, afterNacked, afterTimeout, nullptr});
+}
+
+bool
+Face::submitData(const Data& data)
+{
+  return m_impl->submit({nullptr, nullptr, nullptr, nullptr, make_shared<Data>(data)});
+}
+
+size_t
+Face::getSubmissionQueueDepth() const
+{
+  return m_impl->m_submissionQueue == nullptr ? 0 : m_impl->m_submissionQueue->size();
+}
+
+uint64_t
+Face::getNRejectedSubmissions() const
+{
+  return m_impl->m_nRejectedSubmissions;
+}
+
 RegisteredPrefixHandle
 Face::setInterestFilter(const InterestFilter& filter, const InterestCallback& onInterest,
                         const RegisterPrefixFailureCallback& onFailure,
@@ -311,14 +348,24 @@ extractLpLocalFields(NetPkt& netPacket, const lp::Packet& lpPacket)
 void
 Face::onReceiveElement(const Block& blockFromDaemon)
 {
-  lp::Packet lpPacket(blockFromDaemon); // bare Interest/Data is a valid lp::Packet,
-                                        // no need to distinguish
+  lp::Packet lpPacket;
+  Block netPacket;
+  if (blockFromDaemon.type() == tlv::Interest || blockFromDaemon.type() == tlv::Data) {
+    // bare Interest/Data carries no LP headers, decode it directly without copying
+    netPacket = blockFromDaemon;
+  }
+  else {
+    lpPacket.wireDecode(blockFromDaemon);
+    auto frag = lpPacket.get<lp::FragmentField>();
+    // the fragment is parsed in place, sharing the buffer of the received LpPacket
+    netPacket = Block(blockFromDaemon, frag.first, frag.second);
+  }
 
-  auto frag = lpPacket.get<lp::FragmentField>();
-  Block netPacket({frag.first, frag.second});
   switch (netPacket.type()) {
     case tlv::Interest: {
-      auto interest = make_shared<Interest>(netPacket);
+      bool shouldCheckDigest = !m_isParametersDigestCheckDeferred &&
+                               Interest::getAutoCheckParametersDigest();
+      auto interest = make_shared<Interest>(netPacket, shouldCheckDigest);
       if (lpPacket.has<lp::NackField>()) {
         auto nack = make_shared<lp::Nack>(std::move(*interest));
         nack->setHeader(lpPacket.get<lp::NackField>());
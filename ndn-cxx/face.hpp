@@ -363,6 +363,94 @@ public: // producer
   void
   put(lp::Nack nack);
 
+  /**
+   * @brief Returns whether incoming Interests are decoded without checking their
+   *        ParametersSha256DigestComponent.
+   */
+  bool
+  isParametersDigestCheckDeferred() const noexcept
+  {
+    return m_isParametersDigestCheckDeferred;
+  }
+
+  /**
+   * @brief Defer the ParametersSha256DigestComponent check of incoming Interests.
+   *
+   * By default, each incoming Interest carrying parameters is hashed during decoding if
+   * Interest::getAutoCheckParametersDigest() is true. A producer that validates every incoming
+   * Interest (e.g., through ValidationPolicySignedInterest or ValidationPolicyCommandInterest)
+   * can enable this option so that the digest is computed only once, by the validator, via
+   * Interest::isParametersDigestValid(). Producers that do not validate Interests must check
+   * the digest themselves before trusting the name.
+   */
+  void
+  setParametersDigestCheckDeferred(bool isDeferred) noexcept
+  {
+    m_isParametersDigestCheckDeferred = isDeferred;
+  }
+
+public: // cross-thread submission
+  /**
+   * @brief Enable submitInterest() and submitData() with a queue of the given capacity.
+   * @param capacity maximum number of queued submissions, rounded up to a power of two
+   *
+   * Submissions are stored in a bounded lock-free queue that the io_service thread drains in
+   * batches. A worker thread enqueuing a packet therefore neither takes a lock nor allocates a
+   * handler, and a burst of submissions costs a single io_service wakeup.
+   *
+   * @warning This method is not thread-safe. It must be called before any thread submits packets,
+   *          and must not be called again afterwards.
+   */
+  void
+  enableSubmissionQueue(size_t capacity = 1024);
+
+  /**
+   * @brief Express an Interest from any thread.
+   *
+   * The Interest is expressed on the io_service thread, where the callbacks are also invoked.
+   * Unlike expressInterest(), the Interest cannot be canceled individually.
+   *
+   * If the encoded Interest size exceeds MAX_NDN_PACKET_SIZE, the Interest is dropped on the
+   * io_service thread without invoking any callback, and counted in getNRejectedSubmissions().
+   *
+   * @return whether the Interest has been queued; false if the submission queue is full or has
+   *         not been enabled with enableSubmissionQueue()
+   */
+  bool
+  submitInterest(const Interest& interest,
+                 const DataCallback& afterSatisfied,
+                 const NackCallback& afterNacked,
+                 const TimeoutCallback& afterTimeout);
+
+  /**
+   * @brief Publish a Data packet from any thread.
+   *
+   * The Data is published on the io_service thread, as if put() were called there.
+   *
+   * If the encoded Data size exceeds MAX_NDN_PACKET_SIZE, the Data is dropped on the io_service
+   * thread and counted in getNRejectedSubmissions().
+   *
+   * @return whether the Data has been queued; false if the submission queue is full or has not
+   *         been enabled with enableSubmissionQueue()
+   */
+  bool
+  submitData(const Data& data);
+
+  /**
+   * @brief Returns the number of submissions waiting to be processed on the io_service thread.
+   * @note This method can be called from any thread; the result is approximate.
+   */
+  size_t
+  getSubmissionQueueDepth() const;
+
+  /**
+   * @brief Returns the number of submissions rejected because the submission queue was full,
+   *        or because the packet was oversized.
+   * @note This method can be called from any thread.
+   */
+  uint64_t
+  getNRejectedSubmissions() const;
+
 public: // IO routine
   /**
    * @brief Process any data to receive or call timeout callbacks.
@@ -463,6 +551,8 @@ private:
 
   shared_ptr<Transport> m_transport;
 
+  bool m_isParametersDigestCheckDeferred = false;
+
   /**
    * @brief If not null, a pointer to an internal KeyChain owned by this Face.
    * @note If a KeyChain is supplied to constructor, this pointer will be null,
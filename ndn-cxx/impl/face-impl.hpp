@@ -25,6 +25,7 @@
 #include "ndn-cxx/face.hpp"
 #include "ndn-cxx/impl/interest-filter-record.hpp"
 #include "ndn-cxx/impl/lp-field-tag.hpp"
+#include "ndn-cxx/impl/mpsc-queue.hpp"
 #include "ndn-cxx/impl/pending-interest.hpp"
 #include "ndn-cxx/impl/registered-prefix.hpp"
 #include "ndn-cxx/lp/packet.hpp"
@@ -95,6 +96,7 @@ public: // consumer
     const Interest& interest2 = *interest;
     auto& entry = m_pendingInterestTable.put(id, std::move(interest), afterSatisfied,
                                              afterNacked, afterTimeout, m_scheduler);
+    entry.addToIndex(m_pendingInterestIndex);
 
     lp::Packet lpPacket;
     addFieldFromTag<lp::NextHopFaceIdField, lp::NextHopFaceIdTag>(lpPacket, interest2);
@@ -129,22 +131,23 @@ public: // consumer
   satisfyPendingInterests(const Data& data)
   {
     bool hasAppMatch = false, hasForwarderMatch = false;
-    m_pendingInterestTable.removeIf([&] (PendingInterest& entry) {
-      if (!entry.getInterest()->matchesData(data)) {
-        return false;
+    for (auto id : m_pendingInterestIndex.findDataCandidates(data)) {
+      auto* entry = m_pendingInterestTable.get(id);
+      if (entry == nullptr || !entry->getInterest()->matchesData(data)) {
+        continue;
       }
-      NDN_LOG_DEBUG("   satisfying " << *entry.getInterest() << " from " << entry.getOrigin());
+      NDN_LOG_DEBUG("   satisfying " << *entry->getInterest() << " from " << entry->getOrigin());
 
-      if (entry.getOrigin() == PendingInterestOrigin::APP) {
+      if (entry->getOrigin() == PendingInterestOrigin::APP) {
         hasAppMatch = true;
-        entry.invokeDataCallback(data);
+        entry->invokeDataCallback(data);
       }
       else {
         hasForwarderMatch = true;
       }
 
-      return true;
-    });
+      m_pendingInterestTable.erase(id);
+    }
 
     // if Data matches no pending Interest record, it is sent to the forwarder as unsolicited Data
     return hasForwarderMatch || !hasAppMatch;
@@ -156,25 +159,26 @@ public: // consumer
   nackPendingInterests(const lp::Nack& nack)
   {
     optional<lp::Nack> outNack;
-    m_pendingInterestTable.removeIf([&] (PendingInterest& entry) {
-      if (!nack.getInterest().matchesInterest(*entry.getInterest())) {
-        return false;
+    for (auto id : m_pendingInterestIndex.findByName(nack.getInterest().getName())) {
+      auto* entry = m_pendingInterestTable.get(id);
+      if (entry == nullptr || !nack.getInterest().matchesInterest(*entry->getInterest())) {
+        continue;
       }
-      NDN_LOG_DEBUG("   nacking " << *entry.getInterest() << " from " << entry.getOrigin());
+      NDN_LOG_DEBUG("   nacking " << *entry->getInterest() << " from " << entry->getOrigin());
 
-      optional<lp::Nack> outNack1 = entry.recordNack(nack);
+      optional<lp::Nack> outNack1 = entry->recordNack(nack);
       if (!outNack1) {
-        return false;
+        continue;
       }
 
-      if (entry.getOrigin() == PendingInterestOrigin::APP) {
-        entry.invokeNackCallback(*outNack1);
+      if (entry->getOrigin() == PendingInterestOrigin::APP) {
+        entry->invokeNackCallback(*outNack1);
       }
       else {
         outNack = outNack1;
       }
-      return true;
-    });
+      m_pendingInterestTable.erase(id);
+    }
 
     // send "least severe" Nack from any PendingInterest record originated from forwarder, because
     // it is unimportant to consider Nack reason for the unlikely case when forwarder sends multiple
@@ -187,7 +191,8 @@ public: // producer
   setInterestFilter(detail::RecordId id, const InterestFilter& filter, const InterestCallback& onInterest)
   {
     NDN_LOG_INFO("setting InterestFilter: " << filter);
-    m_interestFilterTable.put(id, filter, onInterest);
+    auto& record = m_interestFilterTable.put(id, filter, onInterest);
+    record.addToIndex(m_interestFilterIndex);
   }
 
   void
@@ -206,6 +211,7 @@ public: // producer
   {
     const Interest& interest2 = *interest;
     auto& entry = m_pendingInterestTable.insert(std::move(interest), m_scheduler);
+    entry.addToIndex(m_pendingInterestIndex);
     dispatchInterest(entry, interest2);
   }
 
@@ -268,6 +274,7 @@ public: // prefix registration
         if (filter) {
           NDN_LOG_INFO("setting InterestFilter: " << *filter);
           auto& filterRecord = m_interestFilterTable.insert(*filter, onInterest);
+          filterRecord.addToIndex(m_interestFilterIndex);
           filterId = filterRecord.getId();
         }
         m_registeredPrefixTable.put(id, prefix, options, filterId);
@@ -298,6 +305,100 @@ public: // prefix registration
     });
   }
 
+public: // cross-thread submission
+  /** @brief A packet submitted from a thread other than the io_service thread
+   *
+   *  Exactly one of interest and data is set.
+   */
+  struct Submission
+  {
+    shared_ptr<const Interest> interest;
+    DataCallback afterSatisfied;
+    NackCallback afterNacked;
+    TimeoutCallback afterTimeout;
+    shared_ptr<const Data> data;
+  };
+
+  /** @brief Enqueue a submission; may be called from any thread
+   *  @return whether the submission was enqueued
+   */
+  bool
+  submit(Submission&& submission)
+  {
+    if (m_submissionQueue == nullptr || !m_submissionQueue->tryPush(std::move(submission))) {
+      ++m_nRejectedSubmissions;
+      return false;
+    }
+
+    scheduleDrainSubmissions();
+    return true;
+  }
+
+  /** @brief Post drainSubmissions() to the io_service, unless it is already pending
+   *
+   *  Only the first submission after a drain wakes up the io_service thread.
+   */
+  void
+  scheduleDrainSubmissions()
+  {
+    if (m_isDrainScheduled.exchange(true)) {
+      return;
+    }
+
+    m_face.getIoService().post([w = weak_ptr<Impl>{shared_from_this()}] { // use weak_from_this() in C++17
+      auto impl = w.lock();
+      if (impl != nullptr) {
+        impl->drainSubmissions();
+      }
+    });
+  }
+
+  /** @brief Process queued submissions on the io_service thread
+   *
+   *  At most SUBMISSION_BATCH_SIZE submissions are processed per invocation, after which the
+   *  remainder is rescheduled so that other io_service handlers are not starved.
+   */
+  void
+  drainSubmissions()
+  {
+    // submissions enqueued from now on schedule another drain
+    m_isDrainScheduled.store(false);
+
+    Submission submission;
+    for (size_t i = 0; i < SUBMISSION_BATCH_SIZE && m_submissionQueue->tryPop(submission); ++i) {
+      bool isInterest = submission.interest != nullptr;
+      auto id = isInterest ? m_pendingInterestTable.allocateId() : 0;
+      try {
+        if (isInterest) {
+          expressInterest(id, std::move(submission.interest),
+                          submission.afterSatisfied, submission.afterNacked, submission.afterTimeout);
+        }
+        else {
+          putData(*submission.data);
+        }
+      }
+      catch (const Face::OversizedPacketError& e) {
+        // the submitter is no longer on the call stack, so the packet is accounted as rejected
+        NDN_LOG_WARN("rejecting submission: " << e.what());
+        if (isInterest) {
+          m_pendingInterestTable.erase(id);
+        }
+        ++m_nRejectedSubmissions;
+      }
+      catch (...) {
+        // do not strand the remaining submissions when an exception escapes io_service::run()
+        if (m_submissionQueue->size() > 0) {
+          scheduleDrainSubmissions();
+        }
+        throw;
+      }
+    }
+
+    if (m_submissionQueue->size() > 0) {
+      scheduleDrainSubmissions();
+    }
+  }
+
 public: // IO routine
   void
   ensureConnected(bool wantResume)
@@ -333,8 +434,8 @@ private:
   finishEncoding(lp::Packet&& lpPacket, Block wire, char pktType, const Name& name)
   {
     if (!lpPacket.empty()) {
-      lpPacket.add<lp::FragmentField>({wire.begin(), wire.end()});
-      wire = lpPacket.wireEncode();
+      // prepend the LP headers in front of the network packet without an intermediate copy
+      wire = lpPacket.wireEncode(wire);
     }
 
     if (wire.size() > MAX_NDN_PACKET_SIZE) {
@@ -347,14 +448,15 @@ private:
   void
   dispatchInterest(PendingInterest& entry, const Interest& interest)
   {
-    m_interestFilterTable.forEach([&] (const InterestFilterRecord& filter) {
-      if (!filter.doesMatch(entry)) {
-        return;
+    for (auto id : m_interestFilterIndex.findCandidates(interest.getName())) {
+      const auto* filter = m_interestFilterTable.get(id);
+      if (filter == nullptr || !filter->doesMatch(entry)) {
+        continue;
       }
-      NDN_LOG_DEBUG("   matches " << filter.getFilter());
+      NDN_LOG_DEBUG("   matches " << filter->getFilter());
       entry.recordForwarding();
-      filter.invokeInterestCallback(interest);
-    });
+      filter->invokeInterestCallback(interest);
+    }
   }
 
   void
@@ -410,12 +512,19 @@ private:
   scheduler::ScopedEventId m_processEventsTimeoutEvent;
   nfd::Controller m_nfdController;
 
+  PendingInterestIndex m_pendingInterestIndex; // must outlive m_pendingInterestTable
   detail::RecordContainer<PendingInterest> m_pendingInterestTable;
+  InterestFilterIndex m_interestFilterIndex; // must outlive m_interestFilterTable
   detail::RecordContainer<InterestFilterRecord> m_interestFilterTable;
   detail::RecordContainer<RegisteredPrefix> m_registeredPrefixTable;
 
   unique_ptr<boost::asio::io_service::work> m_ioServiceWork; // if thread needs to be preserved
 
+  static constexpr size_t SUBMISSION_BATCH_SIZE = 64;
+  unique_ptr<detail::MpscQueue<Submission>> m_submissionQueue;
+  std::atomic<bool> m_isDrainScheduled{false};
+  std::atomic<uint64_t> m_nRejectedSubmissions{0};
+
   friend Face;
 };
 
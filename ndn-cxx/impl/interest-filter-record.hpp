@@ -25,8 +25,96 @@
 #include "ndn-cxx/impl/pending-interest.hpp"
 #include "ndn-cxx/impl/record-container.hpp"
 
+#include <map>
+
 namespace ndn {
 
+/**
+ * @brief Index of Interest filter records by filter prefix.
+ *
+ * The index is a name component trie. Looking up an Interest name visits one trie node per name
+ * component, and returns only the filters whose prefix is a prefix of the Interest name;
+ * the regular expression of such a filter, if any, still needs to be evaluated by the caller.
+ */
+class InterestFilterIndex : noncopyable
+{
+public:
+  void
+  insert(const Name& prefix, detail::RecordId id)
+  {
+    Node* node = &m_root;
+    for (const auto& comp : prefix) {
+      auto& child = node->children[comp];
+      if (child == nullptr) {
+        child = make_unique<Node>();
+      }
+      node = child.get();
+    }
+    // IDs are allocated in increasing order, so every node's list stays sorted
+    node->ids.push_back(id);
+  }
+
+  void
+  erase(const Name& prefix, detail::RecordId id)
+  {
+    eraseFrom(m_root, prefix, 0, id);
+  }
+
+  /**
+   * @brief Find filter records whose prefix is a prefix of @p name
+   * @return record IDs in increasing order
+   */
+  std::vector<detail::RecordId>
+  findCandidates(const Name& name) const
+  {
+    std::vector<detail::RecordId> ids;
+    const Node* node = &m_root;
+    for (size_t i = 0; ; ++i) {
+      ids.insert(ids.end(), node->ids.begin(), node->ids.end());
+      if (i == name.size()) {
+        break;
+      }
+      auto it = node->children.find(name[i]);
+      if (it == node->children.end()) {
+        break;
+      }
+      node = it->second.get();
+    }
+
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+private:
+  struct Node
+  {
+    std::vector<detail::RecordId> ids; ///< records whose filter prefix ends at this node
+    std::map<name::Component, unique_ptr<Node>> children;
+  };
+
+  /**
+   * @return whether @p node has become empty and can be pruned
+   */
+  static bool
+  eraseFrom(Node& node, const Name& prefix, size_t depth, detail::RecordId id)
+  {
+    if (depth == prefix.size()) {
+      node.ids.erase(std::remove(node.ids.begin(), node.ids.end(), id), node.ids.end());
+    }
+    else {
+      auto it = node.children.find(prefix[depth]);
+      BOOST_ASSERT(it != node.children.end());
+      if (eraseFrom(*it->second, prefix, depth + 1, id)) {
+        node.children.erase(it);
+      }
+    }
+    return node.ids.empty() && node.children.empty();
+  }
+
+private:
+  Node m_root;
+};
+
 /**
  * @brief Associates an InterestFilter with an Interest callback.
  */
@@ -45,6 +133,27 @@ public:
   {
   }
 
+  ~InterestFilterRecord()
+  {
+    if (m_index != nullptr) {
+      m_index->erase(m_filter.getPrefix(), getId());
+    }
+  }
+
+  /**
+   * @brief Add this record to @p index
+   *
+   * The record is removed from the index automatically when it is deleted.
+   * @pre the record has been inserted into a RecordContainer, and is not in any index
+   */
+  void
+  addToIndex(InterestFilterIndex& index)
+  {
+    BOOST_ASSERT(m_index == nullptr);
+    index.insert(m_filter.getPrefix(), getId());
+    m_index = &index;
+  }
+
   const InterestFilter&
   getFilter() const
   {
@@ -77,6 +186,7 @@ public:
 private:
   InterestFilter m_filter;
   InterestCallback m_interestCallback;
+  InterestFilterIndex* m_index = nullptr;
 };
 
 } // namespace ndn
@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMPL_MPSC_QUEUE_HPP
+#define NDN_CXX_IMPL_MPSC_QUEUE_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+#include <atomic>
+
+namespace ndn {
+namespace detail {
+
+/** \brief Bounded lock-free multi-producer single-consumer queue.
+ *
+ *  tryPush() may be called concurrently from any number of threads, while tryPop() must be
+ *  called from a single thread at a time. Each slot carries a sequence number that tells
+ *  producers and the consumer whether it is free or holds a published item, so that neither
+ *  side takes a lock.
+ *
+ *  \tparam T item type, must be default-constructible and move-assignable
+ */
+template<typename T>
+class MpscQueue : noncopyable
+{
+public:
+  /** \brief Constructor.
+   *  \param capacity maximum number of queued items, rounded up to a power of two
+   */
+  explicit
+  MpscQueue(size_t capacity)
+  {
+    size_t n = 1;
+    while (n < capacity) {
+      n <<= 1;
+    }
+    m_mask = n - 1;
+    m_slots = make_unique<Slot[]>(n);
+    for (size_t i = 0; i < n; ++i) {
+      m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  /** \brief Enqueue an item.
+   *  \return whether the item was enqueued; false if the queue is full
+   */
+  bool
+  tryPush(T&& item)
+  {
+    size_t pos = m_pushPos.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+      slot = &m_slots[pos & m_mask];
+      size_t seq = slot->sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0) {
+        if (m_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      }
+      else if (diff < 0) {
+        // the slot still holds an item from the previous round
+        return false;
+      }
+      else {
+        pos = m_pushPos.load(std::memory_order_relaxed);
+      }
+    }
+
+    slot->item = std::move(item);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /** \brief Dequeue an item.
+   *  \return whether an item was dequeued into \p item; false if no item has been published
+   *  \note Must not be called concurrently with itself.
+   */
+  bool
+  tryPop(T& item)
+  {
+    size_t pos = m_popPos.load(std::memory_order_relaxed);
+    Slot& slot = m_slots[pos & m_mask];
+    if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+      return false;
+    }
+
+    item = std::move(slot.item);
+    slot.item = T();
+    slot.sequence.store(pos + m_mask + 1, std::memory_order_release);
+    m_popPos.store(pos + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /** \brief Return the number of queued items.
+   *  \note The result is approximate while other threads are pushing or popping.
+   */
+  size_t
+  size() const
+  {
+    size_t popPos = m_popPos.load(std::memory_order_relaxed);
+    size_t pushPos = m_pushPos.load(std::memory_order_relaxed);
+    return pushPos > popPos ? pushPos - popPos : 0;
+  }
+
+  size_t
+  capacity() const
+  {
+    return m_mask + 1;
+  }
+
+private:
+  struct Slot
+  {
+    std::atomic<size_t> sequence{0};
+    T item;
+  };
+
+  unique_ptr<Slot[]> m_slots;
+  size_t m_mask = 0;
+  std::atomic<size_t> m_pushPos{0};
+  std::atomic<size_t> m_popPos{0};
+};
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_CXX_IMPL_MPSC_QUEUE_HPP
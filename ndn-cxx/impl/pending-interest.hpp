@@ -29,6 +29,8 @@
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
 
+#include <unordered_map>
+
 namespace ndn {
 
 /**
@@ -52,6 +54,105 @@ operator<<(std::ostream& os, PendingInterestOrigin origin)
   NDN_CXX_UNREACHABLE;
 }
 
+/**
+ * @brief Index of pending Interests by hash of the Interest name.
+ *
+ * The index allows finding the pending Interests that may be satisfied by a Data packet, or
+ * that may be rejected by a Nack, without visiting every record in the pending Interest table.
+ * Since distinct names may have the same hash value, every candidate returned by the index
+ * must be verified by the caller.
+ */
+class PendingInterestIndex : noncopyable
+{
+public:
+  void
+  insert(const Interest& interest, detail::RecordId id)
+  {
+    // IDs are allocated in increasing order, so every bucket stays sorted
+    m_byHash[interest.getName().getHash()].push_back(id);
+    if (interest.getCanBePrefix()) {
+      ++m_nCanBePrefix;
+    }
+    if (!interest.getName().empty() && interest.getName().get(-1).isImplicitSha256Digest()) {
+      ++m_nImplicitDigest;
+    }
+  }
+
+  void
+  erase(const Interest& interest, detail::RecordId id)
+  {
+    auto it = m_byHash.find(interest.getName().getHash());
+    BOOST_ASSERT(it != m_byHash.end());
+    auto& ids = it->second;
+    ids.erase(std::find(ids.begin(), ids.end(), id));
+    if (ids.empty()) {
+      m_byHash.erase(it);
+    }
+
+    if (interest.getCanBePrefix()) {
+      --m_nCanBePrefix;
+    }
+    if (!interest.getName().empty() && interest.getName().get(-1).isImplicitSha256Digest()) {
+      --m_nImplicitDigest;
+    }
+  }
+
+  /**
+   * @brief Find pending Interests whose name may be the same as @p name
+   * @return record IDs in increasing order
+   */
+  std::vector<detail::RecordId>
+  findByName(const Name& name) const
+  {
+    std::vector<detail::RecordId> ids;
+    appendBucket(name.getHash(), ids);
+    return ids;
+  }
+
+  /**
+   * @brief Find pending Interests that may be satisfied by @p data
+   * @return record IDs in increasing order; each Interest still needs to be checked with
+   *         Interest::matchesData
+   */
+  std::vector<detail::RecordId>
+  findDataCandidates(const Data& data) const
+  {
+    std::vector<detail::RecordId> ids;
+    if (m_nCanBePrefix > 0) {
+      // the hash of the Data name is obtained as a by-product of hashing its prefixes
+      for (size_t hash : data.getName().getPrefixHashes()) {
+        appendBucket(hash, ids);
+      }
+    }
+    else {
+      appendBucket(data.getName().getHash(), ids);
+    }
+    if (m_nImplicitDigest > 0) {
+      appendBucket(data.getFullName().getHash(), ids);
+    }
+
+    // a bucket is visited more than once if several prefixes have the same hash value
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+  }
+
+private:
+  void
+  appendBucket(size_t hash, std::vector<detail::RecordId>& ids) const
+  {
+    auto it = m_byHash.find(hash);
+    if (it != m_byHash.end()) {
+      ids.insert(ids.end(), it->second.begin(), it->second.end());
+    }
+  }
+
+private:
+  std::unordered_map<size_t, std::vector<detail::RecordId>> m_byHash;
+  size_t m_nCanBePrefix = 0; ///< number of indexed Interests with CanBePrefix
+  size_t m_nImplicitDigest = 0; ///< number of indexed Interests whose name ends with a digest
+};
+
 /**
  * @brief Stores a pending Interest and associated callbacks.
  */
@@ -86,6 +187,27 @@ public:
     scheduleTimeoutEvent(scheduler);
   }
 
+  ~PendingInterest()
+  {
+    if (m_index != nullptr) {
+      m_index->erase(*m_interest, getId());
+    }
+  }
+
+  /**
+   * @brief Add this record to @p index
+   *
+   * The record is removed from the index automatically when it is deleted.
+   * @pre the record has been inserted into a RecordContainer, and is not in any index
+   */
+  void
+  addToIndex(PendingInterestIndex& index)
+  {
+    BOOST_ASSERT(m_index == nullptr);
+    index.insert(*m_interest, getId());
+    m_index = &index;
+  }
+
   shared_ptr<const Interest>
   getInterest() const
   {
@@ -181,6 +303,7 @@ private:
   scheduler::ScopedEventId m_timeoutEvent;
   int m_nNotNacked = 0; ///< number of Interest destinations that have not Nacked
   optional<lp::Nack> m_leastSevereNack;
+  PendingInterestIndex* m_index = nullptr;
 };
 
 } // namespace ndn
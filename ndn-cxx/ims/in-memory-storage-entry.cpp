@@ -23,29 +23,17 @@
 
 namespace ndn {
 
-InMemoryStorageEntry::InMemoryStorageEntry()
-  : m_isFresh(true)
-{
-}
-
 void
 InMemoryStorageEntry::release()
 {
   m_dataPacket.reset();
-  m_markStaleEventId.cancel();
 }
 
 void
 InMemoryStorageEntry::setData(const Data& data)
 {
   m_dataPacket = data.shared_from_this();
-  m_isFresh = true;
-}
-
-void
-InMemoryStorageEntry::scheduleMarkStale(Scheduler& sched, time::nanoseconds after)
-{
-  m_markStaleEventId = sched.schedule(after, [this] { m_isFresh = false; });
+  m_staleTime = time::steady_clock::TimePoint::max();
 }
 
 } // namespace ndn
@@ -24,7 +24,8 @@
 
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/interest.hpp"
-#include "ndn-cxx/util/scheduler.hpp"
+#include "ndn-cxx/util/scheduler.hpp" // for the deprecated scheduleMarkStale()
+#include "ndn-cxx/util/time.hpp"
 
 namespace ndn {
 
@@ -33,10 +34,6 @@ namespace ndn {
 class InMemoryStorageEntry : noncopyable
 {
 public:
-  /** @brief Create an entry
-   */
-  InMemoryStorageEntry();
-
   /** @brief Releases reference counts on shared objects
    */
   void
@@ -74,24 +71,46 @@ public:
   void
   setData(const Data& data);
 
-  /** @brief Schedule an event to mark this entry as non-fresh.
+  /** @brief Mark this entry as non-fresh once @p staleTime is reached
+   *
+   *  Staleness is evaluated lazily by isFresh(), so no timer is kept per entry.
    */
   void
-  scheduleMarkStale(Scheduler& sched, time::nanoseconds after);
+  setStaleTime(const time::steady_clock::TimePoint& staleTime)
+  {
+    m_staleTime = staleTime;
+  }
+
+  /** @brief Mark this entry as non-fresh after @p after
+   *  @deprecated Use setStaleTime()
+   */
+  [[deprecated("use setStaleTime()")]]
+  void
+  scheduleMarkStale(Scheduler&, time::nanoseconds after)
+  {
+    setStaleTime(time::steady_clock::now() + after);
+  }
 
   /** @brief Check if the data can satisfy an interest with MustBeFresh
    */
   bool
-  isFresh()
+  isFresh() const
   {
-    return m_isFresh;
+    return m_staleTime == time::steady_clock::TimePoint::max() ||
+           time::steady_clock::now() < m_staleTime;
+  }
+
+  /** @brief Returns the size of the Data packet's wire encoding, in octets
+   */
+  size_t
+  getSize() const
+  {
+    return m_dataPacket->wireEncode().size();
   }
 
 private:
   shared_ptr<const Data> m_dataPacket;
-
-  bool m_isFresh;
-  scheduler::ScopedEventId m_markStaleEventId;
+  time::steady_clock::TimePoint m_staleTime = time::steady_clock::TimePoint::max();
 };
 
 } // namespace ndn
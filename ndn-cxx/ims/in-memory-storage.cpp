@@ -91,8 +91,8 @@ InMemoryStorage::InMemoryStorage(size_t limit)
 InMemoryStorage::InMemoryStorage(boost::asio::io_service& ioService, size_t limit)
   : m_limit(limit)
   , m_nPackets(0)
+  , m_isFreshnessTracked(true)
 {
-  m_scheduler = make_unique<Scheduler>(ioService);
   init();
 }
 
@@ -157,6 +157,18 @@ InMemoryStorage::setCapacity(size_t capacity)
   BOOST_ASSERT(size() + m_freeEntries.size() == m_capacity);
 }
 
+void
+InMemoryStorage::setByteLimit(size_t nMaxBytes)
+{
+  m_byteLimit = nMaxBytes;
+
+  while (m_nBytes > m_byteLimit) {
+    if (!evictItem()) {
+      NDN_THROW(Error());
+    }
+  }
+}
+
 void
 InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow)
 {
@@ -165,6 +177,15 @@ InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshP
   if (it != m_cache.get<byFullName>().end())
     return;
 
+  // if over the byte limit, employ replacement policy until the packet fits
+  size_t dataSize = data.wireEncode().size();
+  if (dataSize > m_byteLimit)
+    return;
+  while (m_nBytes > m_byteLimit - dataSize) {
+    if (!evictItem())
+      return;
+  }
+
   //if full, double the capacity
   bool doesReachLimit = (getLimit() == getCapacity());
   if (isFull() && !doesReachLimit) {
@@ -184,9 +205,10 @@ InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshP
   InMemoryStorageEntry* entry = m_freeEntries.top();
   m_freeEntries.pop();
   m_nPackets++;
+  m_nBytes += dataSize;
   entry->setData(data);
-  if (m_scheduler != nullptr && mustBeFreshProcessingWindow > ZERO_WINDOW) {
-    entry->scheduleMarkStale(*m_scheduler, mustBeFreshProcessingWindow);
+  if (m_isFreshnessTracked && mustBeFreshProcessingWindow > ZERO_WINDOW) {
+    entry->setStaleTime(time::steady_clock::now() + mustBeFreshProcessingWindow);
   }
   m_cache.insert(entry);
 
@@ -197,6 +219,19 @@ InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshP
 shared_ptr<const Data>
 InMemoryStorage::find(const Name& name)
 {
+  // a Data packet with exactly this name is the lowest entry under the prefix
+  InMemoryStorageEntry* exact = nullptr;
+  auto range = m_cache.get<byName>().equal_range(name);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (exact == nullptr || (*it)->getFullName() < exact->getFullName()) {
+      exact = *it;
+    }
+  }
+  if (exact != nullptr) {
+    afterAccess(exact);
+    return exact->getData().shared_from_this();
+  }
+
   auto it = m_cache.get<byFullName>().lower_bound(name);
 
   // if not found, return null
@@ -216,30 +251,45 @@ InMemoryStorage::find(const Name& name)
 shared_ptr<const Data>
 InMemoryStorage::find(const Interest& interest)
 {
-  // if the interest contains implicit digest, it is possible to directly locate a packet.
-  auto it = m_cache.get<byFullName>().find(interest.getName());
+  const Name& name = interest.getName();
 
-  // if a packet is located by its full name, it must be the packet to return.
-  if (it != m_cache.get<byFullName>().end()) {
-    return ((*it)->getData()).shared_from_this();
+  // if the interest contains implicit digest, it is possible to directly locate a packet.
+  if (!name.empty() && name[-1].isImplicitSha256Digest()) {
+    auto range = m_cache.get<byName>().equal_range(name.getPrefix(-1));
+    for (auto it = range.first; it != range.second; ++it) {
+      // if a packet is located by its full name, it must be the packet to return.
+      if ((*it)->getFullName() == name) {
+        return ((*it)->getData()).shared_from_this();
+      }
+    }
   }
 
-  // if the packet is not discovered by last step, either the packet is not in the storage or
-  // the interest doesn't contains implicit digest.
-  it = m_cache.get<byFullName>().lower_bound(interest.getName());
-
-  if (it == m_cache.get<byFullName>().end()) {
+  // Data packets named exactly as the interest precede all other packets under the prefix,
+  // so the best of them, if any, is the best match overall
+  InMemoryStorageEntry* ret = findExactName(interest);
+  if (ret == nullptr && !interest.getCanBePrefix()) {
+    // without CanBePrefix, only the exact name or the full name can match
     return nullptr;
   }
 
-  // to locate the element that has a just smaller name than the interest's
-  if (it != m_cache.get<byFullName>().begin()) {
-    it--;
-  }
-
-  InMemoryStorageEntry* ret = selectChild(interest, it);
   if (ret == nullptr) {
-    return nullptr;
+    // if the packet is not discovered by last step, either the packet is not in the storage or
+    // it has a longer name than the interest.
+    auto it = m_cache.get<byFullName>().lower_bound(name);
+
+    if (it == m_cache.get<byFullName>().end()) {
+      return nullptr;
+    }
+
+    // to locate the element that has a just smaller name than the interest's
+    if (it != m_cache.get<byFullName>().begin()) {
+      it--;
+    }
+
+    ret = selectChild(interest, it);
+    if (ret == nullptr) {
+      return nullptr;
+    }
   }
 
   // let derived class do something with the entry
@@ -247,6 +297,24 @@ InMemoryStorage::find(const Interest& interest)
   return ret->getData().shared_from_this();
 }
 
+InMemoryStorageEntry*
+InMemoryStorage::findExactName(const Interest& interest) const
+{
+  InMemoryStorageEntry* best = nullptr;
+  auto range = m_cache.get<byName>().equal_range(interest.getName());
+  for (auto it = range.first; it != range.second; ++it) {
+    InMemoryStorageEntry* entry = *it;
+    if ((interest.getMustBeFresh() && !entry->isFresh()) ||
+        !interest.matchesData(entry->getData())) {
+      continue;
+    }
+    if (best == nullptr || entry->getFullName() < best->getFullName()) {
+      best = entry;
+    }
+  }
+  return best;
+}
+
 InMemoryStorage::Cache::index<InMemoryStorage::byFullName>::type::iterator
 InMemoryStorage::findNextFresh(Cache::index<byFullName>::type::iterator it) const
 {
@@ -310,11 +378,16 @@ InMemoryStorage::selectChild(const Interest& interest,
 InMemoryStorage::Cache::iterator
 InMemoryStorage::freeEntry(Cache::iterator it)
 {
+  // the entry must still hold its Data while being unlinked from the hashed index
+  InMemoryStorageEntry* entry = *it;
+  m_nBytes -= entry->getSize();
+  auto next = m_cache.erase(it);
+
   // push the *empty* entry into mem pool
-  (*it)->release();
-  m_freeEntries.push(*it);
+  entry->release();
+  m_freeEntries.push(entry);
   m_nPackets--;
-  return m_cache.erase(it);
+  return next;
 }
 
 void
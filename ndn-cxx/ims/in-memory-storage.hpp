@@ -23,11 +23,13 @@
 #define NDN_CXX_IMS_IN_MEMORY_STORAGE_HPP
 
 #include "ndn-cxx/ims/in-memory-storage-entry.hpp"
+#include "ndn-cxx/detail/asio-fwd.hpp"
 
 #include <iterator>
 #include <stack>
 
 #include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/identity.hpp>
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/multi_index/member.hpp>
@@ -43,6 +45,7 @@ class InMemoryStorage : noncopyable
 public:
   // multi_index_container to implement storage
   class byFullName;
+  class byName;
 
   typedef boost::multi_index_container<
     InMemoryStorageEntry*,
@@ -54,6 +57,14 @@ public:
         boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
                                           &InMemoryStorageEntry::getFullName>,
         std::less<Name>
+      >,
+
+      // by Name (without implicit digest), for exact-match lookups
+      boost::multi_index::hashed_non_unique<
+        boost::multi_index::tag<byName>,
+        boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
+                                          &InMemoryStorageEntry::getName>,
+        std::hash<Name>
       >
 
     >
@@ -141,6 +152,9 @@ public:
    *  will be placed in the in-memory storage.
    *
    *  @note It will invoke afterInsert(shared_ptr<InMemoryStorageEntry>).
+   *  @note If storing the packet would exceed the byte limit, entries are evicted according to
+   *  the replacement policy until it fits. If the packet cannot fit, e.g. because it is larger
+   *  than the byte limit or the policy does not evict, the packet is not inserted.
    */
   void
   insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow = INFINITE_WINDOW);
@@ -201,6 +215,31 @@ public:
     return m_nPackets;
   }
 
+  /** @return{ maximum total size, in octets, of the wire encodings of stored packets }
+   */
+  size_t
+  getByteLimit() const
+  {
+    return m_byteLimit;
+  }
+
+  /** @brief Sets the maximum total size, in octets, of the wire encodings of stored packets
+   *
+   *  Entries are evicted according to the replacement policy until the stored packets fit
+   *  within the new limit.
+   *  @throw Error the replacement policy cannot evict enough entries
+   */
+  void
+  setByteLimit(size_t nMaxBytes);
+
+  /** @return{ total size, in octets, of the wire encodings of stored packets }
+   */
+  size_t
+  getNBytes() const
+  {
+    return m_nBytes;
+  }
+
   /** @brief Returns begin iterator of the in-memory storage ordering by
    *  name with digest
    *
@@ -310,6 +349,17 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   selectChild(const Interest& interest,
               Cache::index<byFullName>::type::iterator startingPoint) const;
 
+  /** @brief Finds the best match among entries whose Data name equals the Interest name
+   *
+   *  Uses the hashed index, so the cost does not depend on the number of stored packets.
+   *  Among several qualifying entries (same name, different digests), returns the one with the
+   *  smallest full name, which is the entry that selectChild() would return first.
+   *
+   *  @return{ the best match, if any; otherwise 0 }
+   */
+  InMemoryStorageEntry*
+  findExactName(const Interest& interest) const;
+
   /** @brief Get the next iterator (include startingPoint) that satisfies MustBeFresh requirement
    *
    *  @param startingPoint The iterator to start with.
@@ -338,10 +388,14 @@ private:
   size_t m_capacity;
   /// current number of packets in in-memory storage
   size_t m_nPackets;
+  /// user defined maximum total size of stored packets in octets
+  size_t m_byteLimit = std::numeric_limits<size_t>::max();
+  /// current total size of stored packets in octets
+  size_t m_nBytes = 0;
   /// memory pool
   std::stack<InMemoryStorageEntry*> m_freeEntries;
-  /// scheduler
-  unique_ptr<Scheduler> m_scheduler;
+  /// whether MustBeFresh is handled, i.e. entries become stale after the processing window
+  bool m_isFreshnessTracked = false;
 };
 
 } // namespace ndn
@@ -57,9 +57,19 @@ InterestFilter::operator const Name&() const
 bool
 InterestFilter::doesMatch(const Name& name) const
 {
-  return m_prefix.isPrefixOf(name) &&
-         (!hasRegexFilter() ||
-          m_regexFilter->match(name, m_prefix.size(), name.size() - m_prefix.size()));
+  if (!m_prefix.isPrefixOf(name)) {
+    return false;
+  }
+  if (!hasRegexFilter()) {
+    return true;
+  }
+
+  // the filter may be shared by several faces, so do not record match results in it
+  std::vector<bool> starts(name.size() + 1);
+  starts[m_prefix.size()] = true;
+  std::vector<bool> ends(name.size() + 1);
+  m_regexFilter->findMatchEnds(name, starts, ends);
+  return ends.back();
 }
 
 std::ostream&
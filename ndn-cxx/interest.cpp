@@ -21,10 +21,6 @@
 
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/data.hpp"
-#include "ndn-cxx/encoding/buffer-stream.hpp"
-#include "ndn-cxx/security/transform/digest-filter.hpp"
-#include "ndn-cxx/security/transform/step-source.hpp"
-#include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/util/random.hpp"
 
 #include <boost/range/adaptor/reversed.hpp>
@@ -53,6 +49,11 @@ Interest::Interest(const Block& wire)
   wireDecode(wire);
 }
 
+Interest::Interest(const Block& wire, bool shouldCheckParametersDigest)
+{
+  wireDecode(wire, shouldCheckParametersDigest);
+}
+
 // ---- encode and decode ----
 
 template<encoding::Tag TAG>
@@ -148,6 +149,12 @@ Interest::wireEncode() const
 
 void
 Interest::wireDecode(const Block& wire)
+{
+  wireDecode(wire, s_autoCheckParametersDigest);
+}
+
+void
+Interest::wireDecode(const Block& wire, bool shouldCheckParametersDigest)
 {
   if (wire.type() != tlv::Interest) {
     NDN_THROW(Error("Interest", wire.type()));
@@ -187,6 +194,7 @@ Interest::wireDecode(const Block& wire)
   m_interestLifetime = DEFAULT_INTEREST_LIFETIME;
   m_hopLimit.reset();
   m_parameters.clear();
+  m_isParametersDigestValid = nullopt;
 
   int lastElement = 1; // last recognized element index, in spec order
   for (++element; element != m_wire.elements_end(); ++element) {
@@ -306,7 +314,7 @@ Interest::wireDecode(const Block& wire)
     }
   }
 
-  if (s_autoCheckParametersDigest && !isParametersDigestValid()) {
+  if (shouldCheckParametersDigest && !isParametersDigestValid()) {
     NDN_THROW(Error("ParametersSha256DigestComponent does not match the SHA-256 of Interest parameters"));
   }
 }
@@ -373,6 +381,7 @@ Interest::setName(const Name& name)
 
   if (name != m_name) {
     m_name = name;
+    m_isParametersDigestValid = nullopt;
     if (hasApplicationParameters()) {
       addOrReplaceParametersDigestComponent();
     }
@@ -521,6 +530,7 @@ Interest::unsetApplicationParameters()
   if (digestIndex >= 0) {
     m_name.erase(digestIndex);
   }
+  m_isParametersDigestValid = true;
   m_wire.reset();
   return *this;
 }
@@ -678,39 +688,43 @@ Interest::extractSignedRanges() const
 bool
 Interest::isParametersDigestValid() const
 {
+  if (m_isParametersDigestValid) {
+    return *m_isParametersDigestValid;
+  }
+
   ssize_t digestIndex = findParametersDigestComponent(getName());
   if (digestIndex == -1) {
-    return !hasApplicationParameters();
+    m_isParametersDigestValid = !hasApplicationParameters();
+    return *m_isParametersDigestValid;
   }
   // cannot be -2 because of the checks in setName() and wireDecode()
   BOOST_ASSERT(digestIndex >= 0);
 
   if (!hasApplicationParameters()) {
+    m_isParametersDigestValid = false;
     return false;
   }
 
   const auto& digestComponent = getName()[digestIndex];
   auto digest = computeParametersDigest();
 
-  return std::equal(digestComponent.value_begin(), digestComponent.value_end(),
-                    digest->begin(), digest->end());
+  m_isParametersDigestValid = std::equal(digestComponent.value_begin(), digestComponent.value_end(),
+                                         digest.begin(), digest.end());
+  return *m_isParametersDigestValid;
 }
 
-shared_ptr<Buffer>
+util::Sha256::Digest
 Interest::computeParametersDigest() const
 {
-  using namespace security::transform;
-
-  StepSource in;
-  OBufferStream out;
-  in >> digestFilter(DigestAlgorithm::SHA256) >> streamSink(out);
-
+  InputBuffers bufs;
+  bufs.reserve(m_parameters.size());
   for (const auto& block : m_parameters) {
-    in.write(block);
+    bufs.emplace_back(block.begin(), block.end());
   }
-  in.end();
 
-  return out.buf();
+  util::Sha256::Digest digest;
+  util::Sha256::computeDigest(bufs, digest);
+  return digest;
 }
 
 void
@@ -731,6 +745,7 @@ Interest::addOrReplaceParametersDigestComponent()
     // replace the existing digest component
     m_name.set(digestIndex, std::move(digestComponent));
   }
+  m_isParametersDigestValid = true;
 }
 
 ssize_t
@@ -26,6 +26,7 @@
 #include "ndn-cxx/name.hpp"
 #include "ndn-cxx/security/security-common.hpp"
 #include "ndn-cxx/signature-info.hpp"
+#include "ndn-cxx/util/sha256.hpp"
 #include "ndn-cxx/util/string-helper.hpp"
 #include "ndn-cxx/util/time.hpp"
 
@@ -117,6 +118,14 @@ public:
   explicit
   Interest(const Block& wire);
 
+  /** @brief Construct an Interest by decoding from @p wire.
+   *  @param wire the TLV block to decode
+   *  @param shouldCheckParametersDigest whether to verify the ParametersSha256DigestComponent
+   *         during decoding, overriding getAutoCheckParametersDigest()
+   *  @sa wireDecode(const Block&, bool)
+   */
+  Interest(const Block& wire, bool shouldCheckParametersDigest);
+
   /** @brief Prepend wire encoding to @p encoder.
    */
   template<encoding::Tag TAG>
@@ -129,10 +138,23 @@ public:
   wireEncode() const;
 
   /** @brief Decode from @p wire.
+   *
+   *  The ParametersSha256DigestComponent is verified if getAutoCheckParametersDigest() is true.
    */
   void
   wireDecode(const Block& wire);
 
+  /** @brief Decode from @p wire, explicitly enabling or disabling the digest check.
+   *
+   *  If @p shouldCheckParametersDigest is false, the ParametersSha256DigestComponent is not
+   *  verified during decoding; the caller is then expected to invoke isParametersDigestValid()
+   *  before trusting the name, e.g., as part of signed Interest validation.
+   *
+   *  @throw Error the ParametersSha256DigestComponent is checked and does not match
+   */
+  void
+  wireDecode(const Block& wire, bool shouldCheckParametersDigest);
+
   /** @brief Check if this instance has cached wire encoding.
    */
   bool
@@ -448,6 +470,9 @@ public: // ParametersSha256DigestComponent support
    *  value is correct, or if there is no ParametersSha256DigestComponent in the name and the
    *  Interest does not contain any parameters.
    *  Returns false otherwise.
+   *
+   *  The result is cached until the name or the parameters are modified, so that an Interest
+   *  that was already checked during decoding is not hashed a second time.
    */
   bool
   isParametersDigestValid() const;
@@ -459,7 +484,7 @@ private:
   Interest&
   setSignatureValueInternal(Block sigValue);
 
-  NDN_CXX_NODISCARD shared_ptr<Buffer>
+  NDN_CXX_NODISCARD util::Sha256::Digest
   computeParametersDigest() const;
 
   /** @brief Append a ParametersSha256DigestComponent to the Interest's name
@@ -503,6 +528,9 @@ private:
   // digest in the ParametersSha256DigestComponent.
   std::vector<Block> m_parameters;
 
+  // Cached result of isParametersDigestValid(), reset whenever the name or the parameters change
+  mutable optional<bool> m_isParametersDigestValid;
+
   mutable Block m_wire;
 };
 
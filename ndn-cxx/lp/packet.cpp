@@ -129,12 +129,39 @@ Packet::wireEncode() const
   return m_wire;
 }
 
+template<encoding::Tag TAG>
+size_t
+Packet::wireEncode(EncodingImpl<TAG>& encoder, span<const uint8_t> fragment) const
+{
+  size_t length = prependBinaryBlock(encoder, tlv::Fragment, fragment);
+  for (const Block& element : m_wire.elements() | boost::adaptors::reversed) {
+    length += prependBlock(encoder, element);
+  }
+  length += encoder.prependVarNumber(length);
+  length += encoder.prependVarNumber(tlv::LpPacket);
+  return length;
+}
+
+Block
+Packet::wireEncode(span<const uint8_t> fragment) const
+{
+  BOOST_ASSERT(!has<FragmentField>());
+
+  EncodingEstimator estimator;
+  size_t estimatedSize = wireEncode(estimator, fragment);
+
+  EncodingBuffer buffer(estimatedSize, 0);
+  wireEncode(buffer, fragment);
+  return buffer.block();
+}
+
 void
 Packet::wireDecode(const Block& wire)
 {
   if (wire.type() == ndn::tlv::Interest || wire.type() == ndn::tlv::Data) {
+    // nest the network packet as TLV-VALUE of FragmentField, sharing its buffer
     m_wire = Block(tlv::LpPacket);
-    add<FragmentField>({wire.begin(), wire.end()});
+    m_wire.push_back(Block(tlv::Fragment, wire));
     return;
   }
 
@@ -47,8 +47,24 @@ public:
   Block
   wireEncode() const;
 
+  /**
+   * \brief encode packet into wire format, carrying \p fragment in FragmentField
+   *
+   * The header fields are prepended in front of the fragment within a single buffer, so that
+   * the fragment is copied only once. The result is the same as add<FragmentField>() followed
+   * by wireEncode(), but this packet is not modified.
+   *
+   * \pre packet does not contain FragmentField
+   */
+  Block
+  wireEncode(span<const uint8_t> fragment) const;
+
   /**
    * \brief decode packet from wire format
+   *
+   * Fields, including a FragmentField wrapping a bare Interest or Data, share the buffer
+   * of \p wire instead of copying it.
+   *
    * \throws Error unknown TLV-TYPE
    */
   void
@@ -198,6 +214,10 @@ public: // field access
   }
 
 private:
+  template<encoding::Tag TAG>
+  size_t
+  wireEncode(EncodingImpl<TAG>& encoder, span<const uint8_t> fragment) const;
+
   static bool
   comparePos(uint64_t first, const Block& second) noexcept;
 
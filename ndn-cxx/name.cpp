@@ -154,6 +154,7 @@ Name::wireDecode(const Block& wire)
 
   m_wire = wire;
   m_wire.parse();
+  m_hash = nullopt;
 }
 
 Name
@@ -211,6 +212,7 @@ Name::set(ssize_t i, const Component& component)
 
   const_cast<Block::element_container&>(m_wire.elements())[i] = component;
   m_wire.resetWire();
+  m_hash = nullopt;
   return *this;
 }
 
@@ -223,6 +225,7 @@ Name::set(ssize_t i, Component&& component)
 
   const_cast<Block::element_container&>(m_wire.elements())[i] = std::move(component);
   m_wire.resetWire();
+  m_hash = nullopt;
   return *this;
 }
 
@@ -275,12 +278,14 @@ Name::erase(ssize_t i)
   else {
     m_wire.erase(std::prev(m_wire.elements_end(), -i));
   }
+  m_hash = nullopt;
 }
 
 void
 Name::clear()
 {
   m_wire = Block(tlv::Name);
+  m_hash = nullopt;
 }
 
 // ---- algorithms ----
@@ -343,6 +348,44 @@ Name::compare(size_t pos1, size_t count1, const Name& other, size_t pos2, size_t
   return count1 - count2;
 }
 
+static size_t
+hashComponent(const name::Component& component)
+{
+  size_t seed = component.type();
+  boost::hash_range(seed, component.value_begin(), component.value_end());
+  return seed;
+}
+
+size_t
+Name::getHash() const
+{
+  if (!m_hash) {
+    size_t seed = 0;
+    for (const auto& component : *this) {
+      boost::hash_combine(seed, hashComponent(component));
+    }
+    m_hash = seed;
+  }
+  return *m_hash;
+}
+
+std::vector<size_t>
+Name::getPrefixHashes() const
+{
+  std::vector<size_t> hashes;
+  hashes.reserve(size() + 1);
+
+  size_t seed = 0;
+  hashes.push_back(seed);
+  for (const auto& component : *this) {
+    boost::hash_combine(seed, hashComponent(component));
+    hashes.push_back(seed);
+  }
+
+  m_hash = seed;
+  return hashes;
+}
+
 // ---- URI representation ----
 
 void
@@ -384,7 +427,7 @@ namespace std {
 size_t
 hash<ndn::Name>::operator()(const ndn::Name& name) const
 {
-  return boost::hash_range(name.wireEncode().begin(), name.wireEncode().end());
+  return name.getHash();
 }
 
 } // namespace std
@@ -275,6 +275,7 @@ public: // modifiers
   append(const Component& component)
   {
     m_wire.push_back(component);
+    m_hash = nullopt;
     return *this;
   }
 
@@ -285,6 +286,7 @@ public: // modifiers
   append(Component&& component)
   {
     m_wire.push_back(std::move(component));
+    m_hash = nullopt;
     return *this;
   }
 
@@ -640,6 +642,26 @@ public: // algorithms
   compare(size_t pos1, size_t count1,
           const Name& other, size_t pos2 = 0, size_t count2 = npos) const;
 
+  /** @brief Return a hash value of this name
+   *
+   *  The hash value is computed incrementally, by combining a hash of each name component in
+   *  turn; it is cached until the name is modified. This is the value returned by
+   *  `std::hash<Name>`.
+   *
+   *  @sa getPrefixHashes()
+   */
+  size_t
+  getHash() const;
+
+  /** @brief Return the hash values of all prefixes of this name, computed in one pass
+   *  @return a vector of `size() + 1` elements, where element @c i equals `getPrefix(i).getHash()`
+   *
+   *  This allows a longest prefix match lookup in a hash table to hash the lookup name once,
+   *  instead of once for every prefix.
+   */
+  std::vector<size_t>
+  getPrefixHashes() const;
+
 private: // non-member operators
   // NOTE: the following "hidden friend" operators are available via
   //       argument-dependent lookup only and must be defined inline.
@@ -697,6 +719,7 @@ public:
 
 private:
   mutable Block m_wire;
+  mutable optional<size_t> m_hash; ///< cached result of getHash()
 };
 
 NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(Name);
@@ -103,16 +103,7 @@ CertificateBundleFetcher::fetchFirstBundleSegment(const Name& bundleNamePrefix,
   bundleInterest.setMustBeFresh(true);
   bundleInterest.setInterestLifetime(m_bundleInterestLifetime);
 
-  m_face.expressInterest(bundleInterest,
-                         [=] (const Interest&, const Data& data) {
-                           dataCallback(data, true, certRequest, state, continueValidation);
-                         },
-                         [=] (const Interest&, const lp::Nack& nack) {
-                           nackCallback(nack, certRequest, state, continueValidation, bundleNamePrefix);
-                         },
-                         [=] (const Interest&) {
-                           timeoutCallback(certRequest, state, continueValidation, bundleNamePrefix);
-                         });
+  expressBundleInterest(bundleInterest, true, certRequest, state, continueValidation);
 }
 
 void
@@ -131,15 +122,49 @@ CertificateBundleFetcher::fetchNextBundleSegment(const Name& fullBundleName, con
   bundleInterest.setMustBeFresh(false);
   bundleInterest.setInterestLifetime(m_bundleInterestLifetime);
 
-  m_face.expressInterest(bundleInterest,
+  expressBundleInterest(bundleInterest, false, certRequest, state, continueValidation);
+}
+
+void
+CertificateBundleFetcher::expressBundleInterest(const Interest& interest, bool isSegmentZeroExpected,
+                                                const shared_ptr<CertificateRequest>& certRequest,
+                                                const shared_ptr<ValidationState>& state,
+                                                const ValidationContinuation& continueValidation)
+{
+  const Name& bundleName = interest.getName();
+  auto& waiters = m_pendingBundleInterests[bundleName];
+  waiters.push_back({certRequest, state, continueValidation});
+  if (waiters.size() > 1) {
+    NDN_LOG_TRACE_DEPTH("Waiting for pending bundle Interest " << bundleName);
+    return;
+  }
+
+  // the waiters are removed before any callback runs, as validation may continue with
+  // another request for the same bundle segment
+  auto takeWaiters = [this, bundleName] {
+    auto it = m_pendingBundleInterests.find(bundleName);
+    BOOST_ASSERT(it != m_pendingBundleInterests.end());
+    auto waiters = std::move(it->second);
+    m_pendingBundleInterests.erase(it);
+    return waiters;
+  };
+
+  m_face.expressInterest(interest,
                          [=] (const Interest&, const Data& data) {
-                           dataCallback(data, false, certRequest, state, continueValidation);
+                           for (const auto& w : takeWaiters()) {
+                             dataCallback(data, isSegmentZeroExpected,
+                                          w.certRequest, w.state, w.continueValidation);
+                           }
                          },
                          [=] (const Interest&, const lp::Nack& nack) {
-                           nackCallback(nack, certRequest, state, continueValidation, fullBundleName);
+                           for (const auto& w : takeWaiters()) {
+                             nackCallback(nack, w.certRequest, w.state, w.continueValidation, bundleName);
+                           }
                          },
                          [=] (const Interest&) {
-                           timeoutCallback(certRequest, state, continueValidation, fullBundleName);
+                           for (const auto& w : takeWaiters()) {
+                             timeoutCallback(w.certRequest, w.state, w.continueValidation, bundleName);
+                           }
                          });
 }
 
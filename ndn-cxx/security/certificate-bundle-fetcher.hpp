@@ -22,10 +22,13 @@
 #ifndef NDN_CXX_SECURITY_CERTIFICATE_BUNDLE_FETCHER_HPP
 #define NDN_CXX_SECURITY_CERTIFICATE_BUNDLE_FETCHER_HPP
 
+#include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/name.hpp"
 #include "ndn-cxx/tag.hpp"
 #include "ndn-cxx/security/certificate-fetcher-from-network.hpp"
 
+#include <map>
+
 namespace ndn {
 namespace security {
 inline namespace v2 {
@@ -38,6 +41,11 @@ inline namespace v2 {
  * fetcher. Inner fetcher is used when the bundle interest times out or returns a Nack or when
  * additional certificates are needed for validation.
  *
+ * Requests for the same bundle segment are coalesced: while a bundle Interest is pending, further
+ * requests that would express an Interest with the same name wait for its outcome instead. This
+ * happens, for example, when several segments of the same object are validated concurrently,
+ * because they share a bundle name.
+ *
  * @sa https://redmine.named-data.net/projects/ndn-cxx/wiki/Certificate_Bundle_Packet_Format
  */
 class CertificateBundleFetcher : public CertificateFetcher
@@ -94,6 +102,16 @@ private:
                          const shared_ptr<ValidationState>& state,
                          const ValidationContinuation& continueValidation);
 
+  /**
+   * @brief Express @p interest for a bundle segment, unless an Interest with the same name is
+   *        already pending, in which case the request waits for the outcome of that Interest.
+   */
+  void
+  expressBundleInterest(const Interest& interest, bool isSegmentZeroExpected,
+                        const shared_ptr<CertificateRequest>& certRequest,
+                        const shared_ptr<ValidationState>& state,
+                        const ValidationContinuation& continueValidation);
+
   /**
    * @brief Derive bundle name from data name.
    *
@@ -142,6 +160,15 @@ private:
   using BundleNameTag = SimpleTag<Name, 1000>;
   using FinalBlockIdTag = SimpleTag<name::Component, 1001>;
   time::milliseconds m_bundleInterestLifetime;
+
+  struct BundleWaiter
+  {
+    shared_ptr<CertificateRequest> certRequest;
+    shared_ptr<ValidationState> state;
+    ValidationContinuation continueValidation;
+  };
+  /// requests waiting for a pending bundle Interest, keyed by the Interest name
+  std::map<Name, std::vector<BundleWaiter>> m_pendingBundleInterests;
 };
 
 } // inline namespace v2
@@ -34,10 +34,11 @@ CertificateCache::getDefaultLifetime()
   return 1_h;
 }
 
-CertificateCache::CertificateCache(const time::nanoseconds& maxLifetime)
+CertificateCache::CertificateCache(const time::nanoseconds& maxLifetime, PublicKeyCache* keyCache)
   : m_certsByTime(m_certs.get<0>())
   , m_certsByName(m_certs.get<1>())
   , m_maxLifetime(maxLifetime)
+  , m_keyCache(keyCache)
 {
 }
 
@@ -60,6 +61,11 @@ CertificateCache::insert(const Certificate& cert)
 void
 CertificateCache::clear()
 {
+  if (m_keyCache != nullptr) {
+    for (const auto& entry : m_certs) {
+      m_keyCache->erase(entry.cert.getFullName());
+    }
+  }
   m_certs.clear();
 }
 
@@ -95,6 +101,17 @@ CertificateCache::find(const Interest& interest) const
   return nullptr;
 }
 
+optional<time::system_clock::TimePoint>
+CertificateCache::getRemovalTime(const Name& certName) const
+{
+  const_cast<CertificateCache*>(this)->refresh();
+  auto itr = m_certsByName.find(certName);
+  if (itr == m_certsByName.end()) {
+    return nullopt;
+  }
+  return itr->removalTime;
+}
+
 void
 CertificateCache::refresh()
 {
@@ -102,6 +119,9 @@ CertificateCache::refresh()
 
   auto cIt = m_certsByTime.begin();
   while (cIt != m_certsByTime.end() && cIt->removalTime < now) {
+    if (m_keyCache != nullptr) {
+      m_keyCache->erase(cIt->cert.getFullName());
+    }
     m_certsByTime.erase(cIt);
     cIt = m_certsByTime.begin();
   }
@@ -24,6 +24,7 @@
 
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/security/certificate.hpp"
+#include "ndn-cxx/security/public-key-cache.hpp"
 
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/ordered_index.hpp>
@@ -47,9 +48,12 @@ public:
    * @brief Create an object for certificate cache.
    *
    * @param maxLifetime the maximum time that certificates could live inside cache (default: 1 hour)
+   * @param keyCache if not nullptr, parsed public keys of removed certificates are dropped from
+   *                 this cache; it must outlive the certificate cache
    */
   explicit
-  CertificateCache(const time::nanoseconds& maxLifetime = getDefaultLifetime());
+  CertificateCache(const time::nanoseconds& maxLifetime = getDefaultLifetime(),
+                   PublicKeyCache* keyCache = nullptr);
 
   /**
    * @brief Insert certificate into cache.
@@ -88,6 +92,14 @@ public:
   const Certificate*
   find(const Interest& interest) const;
 
+  /**
+   * @brief Get the time when a certificate will be removed from the cache
+   * @param certName  Full name of the certificate, without the implicit digest.
+   * @return The removal time, nullopt if the certificate is not in the cache.
+   */
+  optional<time::system_clock::TimePoint>
+  getRemovalTime(const Name& certName) const;
+
 private:
   class Entry
   {
@@ -139,6 +151,7 @@ private:
   CertIndexByTime& m_certsByTime;
   CertIndexByName& m_certsByName;
   time::nanoseconds m_maxLifetime;
+  PublicKeyCache* m_keyCache;
 };
 
 } // inline namespace v2
@@ -46,6 +46,12 @@ CertificateFetcherDirectFetch::doFetch(const shared_ptr<CertificateRequest>& key
                                        const shared_ptr<ValidationState>& state,
                                        const ValidationContinuation& continueValidation)
 {
+  if (!m_wantDirectInterestOnly &&
+      (isPendingForOtherRequest(keyRequest) || isNegativelyCached(keyRequest->interest.getName()))) {
+    // waits for the pending request or fails right away, without sending a direct Interest
+    return CertificateFetcherFromNetwork::doFetch(keyRequest, state, continueValidation);
+  }
+
   auto interestState = dynamic_pointer_cast<InterestValidationState>(state);
   uint64_t incomingFaceId = 0;
   if (interestState != nullptr) {
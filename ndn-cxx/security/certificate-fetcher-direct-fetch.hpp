@@ -36,6 +36,10 @@ inline namespace v2 {
  * this fetcher will send a "direct Interest" to fetch certificates from the face where the original
  * packet was received, in addition to fetching from the infrastructure. The application must
  * enable NextHopFaceId privilege on the face used by this fetcher prior to the validation.
+ *
+ * Requests for a certificate that is already being fetched wait for the pending request, and
+ * send neither a direct nor an infrastructure Interest. In direct-only mode, every request
+ * sends its own direct Interest, because the target face depends on each packet.
  */
 class CertificateFetcherDirectFetch : public CertificateFetcherFromNetwork
 {
@@ -23,6 +23,7 @@
 
 #include "ndn-cxx/face.hpp"
 #include "ndn-cxx/security/certificate-request.hpp"
+#include "ndn-cxx/security/certificate-storage.hpp"
 #include "ndn-cxx/security/validation-state.hpp"
 #include "ndn-cxx/util/logger.hpp"
 
@@ -41,23 +42,171 @@ CertificateFetcherFromNetwork::CertificateFetcherFromNetwork(Face& face)
 {
 }
 
+void
+CertificateFetcherFromNetwork::setNegativeCacheLifetime(time::nanoseconds lifetime)
+{
+  m_negativeCacheLifetime = lifetime;
+  if (m_negativeCacheLifetime <= 0_ns) {
+    m_negativeCache.clear();
+  }
+}
+
 void
 CertificateFetcherFromNetwork::doFetch(const shared_ptr<CertificateRequest>& certRequest,
                                        const shared_ptr<ValidationState>& state,
                                        const ValidationContinuation& continueValidation)
 {
+  const Name& certName = certRequest->interest.getName();
+
+  auto it = m_pendingRequests.find(certName);
+  if (it != m_pendingRequests.end()) {
+    if (it->second.request == certRequest) {
+      // retransmission of the pending request
+      return expressCertificateInterest(certRequest);
+    }
+
+    NDN_LOG_TRACE_DEPTH("Waiting for the pending Interest for certificate " << certName);
+    it->second.waiters.emplace_back(state, continueValidation);
+    ++m_stats.nCoalescedRequests;
+    return;
+  }
+
+  if (isNegativelyCached(certName)) {
+    NDN_LOG_DEBUG_DEPTH("Certificate " << certName << " could not be fetched recently");
+    ++m_stats.nNegativeCacheHits;
+    return state->fail({ValidationError::Code::CANNOT_RETRIEVE_CERT, "Cannot fetch certificate `" +
+                        certName.toUri() + "`, it could not be retrieved recently"});
+  }
+
+  auto& pending = m_pendingRequests[certName];
+  pending.request = certRequest;
+  pending.waiters.emplace_back(state, continueValidation);
+  expressCertificateInterest(certRequest);
+}
+
+void
+CertificateFetcherFromNetwork::expressCertificateInterest(const shared_ptr<CertificateRequest>& certRequest)
+{
+  ++m_stats.nInterests;
   m_face.expressInterest(certRequest->interest,
                          [=] (const Interest&, const Data& data) {
-                           dataCallback(data, certRequest, state, continueValidation);
+                           onCertificateData(data, certRequest);
                          },
                          [=] (const Interest&, const lp::Nack& nack) {
-                           nackCallback(nack, certRequest, state, continueValidation);
+                           NDN_LOG_DEBUG("NACK (" << nack.getReason() << ") while fetching certificate "
+                                         << certRequest->interest.getName());
+                           auto retryDelay = certRequest->waitAfterNack;
+                           certRequest->waitAfterNack *= 2;
+                           onCertificateFailure(certRequest, retryDelay);
                          },
                          [=] (const Interest&) {
-                           timeoutCallback(certRequest, state, continueValidation);
+                           NDN_LOG_DEBUG("Timeout while fetching certificate "
+                                         << certRequest->interest.getName());
+                           onCertificateFailure(certRequest, 0_ms);
                          });
 }
 
+void
+CertificateFetcherFromNetwork::onCertificateData(const Data& data,
+                                                 const shared_ptr<CertificateRequest>& certRequest)
+{
+  auto it = m_pendingRequests.find(certRequest->interest.getName());
+  if (it == m_pendingRequests.end() || it->second.request != certRequest) {
+    return;
+  }
+
+  auto waiters = std::move(it->second.waiters);
+  m_pendingRequests.erase(it);
+  for (const auto& waiter : waiters) {
+    dataCallback(data, certRequest, waiter.first, waiter.second);
+  }
+}
+
+void
+CertificateFetcherFromNetwork::onCertificateFailure(const shared_ptr<CertificateRequest>& certRequest,
+                                                    time::milliseconds retryDelay)
+{
+  --certRequest->nRetriesLeft;
+  if (certRequest->nRetriesLeft >= 0) {
+    if (retryDelay > 0_ms) {
+      m_scheduler.schedule(retryDelay, [=] { retryCertificateRequest(certRequest); });
+    }
+    else {
+      retryCertificateRequest(certRequest);
+    }
+    return;
+  }
+
+  const Name& certName = certRequest->interest.getName();
+  auto it = m_pendingRequests.find(certName);
+  if (it == m_pendingRequests.end() || it->second.request != certRequest) {
+    return;
+  }
+
+  auto waiters = std::move(it->second.waiters);
+  m_pendingRequests.erase(it);
+  ++m_stats.nFailures;
+
+  if (m_negativeCacheLifetime > 0_ns) {
+    auto now = time::steady_clock::now();
+    // drop expired entries, so that the cache only holds certificates that failed recently
+    for (auto entry = m_negativeCache.begin(); entry != m_negativeCache.end();) {
+      entry = entry->second <= now ? m_negativeCache.erase(entry) : std::next(entry);
+    }
+    m_negativeCache[certName] = now + m_negativeCacheLifetime;
+  }
+
+  for (const auto& waiter : waiters) {
+    waiter.first->fail({ValidationError::Code::CANNOT_RETRIEVE_CERT, "Cannot fetch certificate after all "
+                        "retries `" + certName.toUri() + "`"});
+  }
+}
+
+void
+CertificateFetcherFromNetwork::retryCertificateRequest(const shared_ptr<CertificateRequest>& certRequest)
+{
+  auto it = m_pendingRequests.find(certRequest->interest.getName());
+  if (it == m_pendingRequests.end() || it->second.request != certRequest) {
+    return;
+  }
+
+  // the certificate may have been retrieved by another request in the meantime
+  auto cert = m_certStorage->getUnverifiedCertCache().find(certRequest->interest);
+  if (cert != nullptr) {
+    auto waiters = std::move(it->second.waiters);
+    m_pendingRequests.erase(it);
+    for (const auto& waiter : waiters) {
+      waiter.second(*cert, waiter.first);
+    }
+    return;
+  }
+
+  // retransmit on behalf of the first waiter, so that subclasses can send their Interests again
+  auto first = it->second.waiters.front();
+  doFetch(certRequest, first.first, first.second);
+}
+
+bool
+CertificateFetcherFromNetwork::isPendingForOtherRequest(const shared_ptr<CertificateRequest>& certRequest) const
+{
+  auto it = m_pendingRequests.find(certRequest->interest.getName());
+  return it != m_pendingRequests.end() && it->second.request != certRequest;
+}
+
+bool
+CertificateFetcherFromNetwork::isNegativelyCached(const Name& certName)
+{
+  auto it = m_negativeCache.find(certName);
+  if (it == m_negativeCache.end()) {
+    return false;
+  }
+  if (it->second > time::steady_clock::now()) {
+    return true;
+  }
+  m_negativeCache.erase(it);
+  return false;
+}
+
 void
 CertificateFetcherFromNetwork::dataCallback(const Data& data,
                                             const shared_ptr<CertificateRequest>&,
@@ -22,9 +22,12 @@
 #ifndef NDN_CXX_SECURITY_CERTIFICATE_FETCHER_FROM_NETWORK_HPP
 #define NDN_CXX_SECURITY_CERTIFICATE_FETCHER_FROM_NETWORK_HPP
 
+#include "ndn-cxx/name.hpp"
 #include "ndn-cxx/security/certificate-fetcher.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
 
+#include <map>
+
 namespace ndn {
 
 class Data;
@@ -39,13 +42,50 @@ inline namespace v2 {
 
 /**
  * @brief Fetch missing keys from the network
+ *
+ * Requests for the same certificate name are coalesced: while an Interest for a certificate is
+ * pending, further requests for it wait for the outcome of that Interest instead of expressing
+ * another one. A certificate that could not be retrieved after all retries is remembered for
+ * a configurable period, during which requests for it fail immediately.
  */
 class CertificateFetcherFromNetwork : public CertificateFetcher
 {
 public:
+  struct Statistics
+  {
+    /// Interests expressed for certificates, including retransmissions
+    uint64_t nInterests = 0;
+    /// requests that waited for a pending Interest instead of expressing a new one
+    uint64_t nCoalescedRequests = 0;
+    /// requests that failed because the certificate could not be retrieved recently
+    uint64_t nNegativeCacheHits = 0;
+    /// certificates that could not be retrieved after all retries
+    uint64_t nFailures = 0;
+  };
+
   explicit
   CertificateFetcherFromNetwork(Face& face);
 
+  const Statistics&
+  getStatistics() const
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief Set for how long a certificate that could not be retrieved is not requested again
+   *
+   * A zero lifetime disables the negative cache. The default is 10 seconds.
+   */
+  void
+  setNegativeCacheLifetime(time::nanoseconds lifetime);
+
+  time::nanoseconds
+  getNegativeCacheLifetime() const
+  {
+    return m_negativeCacheLifetime;
+  }
+
 protected:
   void
   doFetch(const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state,
@@ -78,9 +118,48 @@ protected:
   timeoutCallback(const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state,
                   const ValidationContinuation& continueValidation);
 
+  /**
+   * @brief Whether @p certName could not be retrieved within the negative cache lifetime
+   */
+  bool
+  isNegativelyCached(const Name& certName);
+
+  /**
+   * @brief Whether an Interest for the certificate of @p certRequest is pending on behalf of
+   *        another request, so that fetching @p certRequest only waits for its outcome
+   */
+  bool
+  isPendingForOtherRequest(const shared_ptr<CertificateRequest>& certRequest) const;
+
+private:
+  void
+  expressCertificateInterest(const shared_ptr<CertificateRequest>& certRequest);
+
+  void
+  onCertificateData(const Data& data, const shared_ptr<CertificateRequest>& certRequest);
+
+  void
+  onCertificateFailure(const shared_ptr<CertificateRequest>& certRequest, time::milliseconds retryDelay);
+
+  void
+  retryCertificateRequest(const shared_ptr<CertificateRequest>& certRequest);
+
 protected:
   Face& m_face;
   Scheduler m_scheduler;
+
+private:
+  struct PendingRequest
+  {
+    /// the request whose Interest is pending; it carries the retry counters
+    shared_ptr<CertificateRequest> request;
+    std::vector<std::pair<shared_ptr<ValidationState>, ValidationContinuation>> waiters;
+  };
+
+  std::map<Name, PendingRequest> m_pendingRequests;
+  std::map<Name, time::steady_clock::TimePoint> m_negativeCache;
+  time::nanoseconds m_negativeCacheLifetime = 10_s;
+  Statistics m_stats;
 };
 
 } // inline namespace v2
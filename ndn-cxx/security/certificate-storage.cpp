@@ -26,7 +26,8 @@ namespace security {
 inline namespace v2 {
 
 CertificateStorage::CertificateStorage()
-  : m_verifiedCertCache(1_h)
+  : m_trustAnchors(&m_publicKeyCache)
+  , m_verifiedCertCache(1_h, &m_publicKeyCache)
   , m_unverifiedCertCache(5_min)
 {
 }
@@ -106,6 +107,18 @@ CertificateStorage::getUnverifiedCertCache() const
   return m_unverifiedCertCache;
 }
 
+PublicKeyCache&
+CertificateStorage::getPublicKeyCache()
+{
+  return m_publicKeyCache;
+}
+
+const PublicKeyCache&
+CertificateStorage::getPublicKeyCache() const
+{
+  return m_publicKeyCache;
+}
+
 } // inline namespace v2
 } // namespace security
 } // namespace ndn
@@ -24,6 +24,7 @@
 
 #include "ndn-cxx/security/certificate.hpp"
 #include "ndn-cxx/security/certificate-cache.hpp"
+#include "ndn-cxx/security/public-key-cache.hpp"
 #include "ndn-cxx/security/trust-anchor-container.hpp"
 
 namespace ndn {
@@ -82,6 +83,15 @@ public:
   const CertificateCache&
   getUnverifiedCertCache() const;
 
+  /**
+   * @return Cache of parsed public keys of trust anchors and verified certificates
+   */
+  PublicKeyCache&
+  getPublicKeyCache();
+
+  const PublicKeyCache&
+  getPublicKeyCache() const;
+
 protected:
   /**
    * @brief load static trust anchor.
@@ -131,6 +141,8 @@ protected:
   resetVerifiedCerts();
 
 protected:
+  // must be declared before the containers that share it
+  PublicKeyCache m_publicKeyCache;
   TrustAnchorContainer m_trustAnchors;
   CertificateCache m_verifiedCertCache;
   CertificateCache m_unverifiedCertCache;
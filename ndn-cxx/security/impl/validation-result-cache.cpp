@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/impl/validation-result-cache.hpp"
+
+namespace ndn {
+namespace security {
+namespace detail {
+
+ValidationResultCache::ValidationResultCache(size_t capacity)
+  : m_capacity(capacity)
+{
+  BOOST_ASSERT(capacity > 0);
+}
+
+bool
+ValidationResultCache::find(const Name& fullName, uint64_t anchorsVersion)
+{
+  checkAnchorsVersion(anchorsVersion);
+
+  auto& byName = m_entries.get<1>();
+  auto it = byName.find(fullName);
+  if (it == byName.end()) {
+    return false;
+  }
+
+  auto entry = m_entries.project<0>(it);
+  if (entry->expiry <= time::system_clock::now()) {
+    m_entries.erase(entry);
+    return false;
+  }
+
+  m_entries.relocate(m_entries.begin(), entry);
+  return true;
+}
+
+void
+ValidationResultCache::insert(const Name& fullName, const time::system_clock::TimePoint& expiry,
+                              uint64_t anchorsVersion)
+{
+  checkAnchorsVersion(anchorsVersion);
+
+  auto& byName = m_entries.get<1>();
+  auto it = byName.find(fullName);
+  if (it != byName.end()) {
+    byName.modify(it, [&] (Entry& entry) { entry.expiry = expiry; });
+    m_entries.relocate(m_entries.begin(), m_entries.project<0>(it));
+    return;
+  }
+
+  if (m_entries.size() >= m_capacity) {
+    m_entries.pop_back();
+  }
+  m_entries.push_front({fullName, expiry});
+}
+
+void
+ValidationResultCache::clear()
+{
+  m_entries.clear();
+}
+
+void
+ValidationResultCache::checkAnchorsVersion(uint64_t anchorsVersion)
+{
+  if (anchorsVersion != m_anchorsVersion) {
+    m_entries.clear();
+    m_anchorsVersion = anchorsVersion;
+  }
+}
+
+} // namespace detail
+} // namespace security
+} // namespace ndn
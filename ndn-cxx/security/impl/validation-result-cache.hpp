@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_IMPL_VALIDATION_RESULT_CACHE_HPP
+#define NDN_CXX_SECURITY_IMPL_VALIDATION_RESULT_CACHE_HPP
+
+#include "ndn-cxx/name.hpp"
+#include "ndn-cxx/util/time.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+
+namespace ndn {
+namespace security {
+namespace detail {
+
+/**
+ * @brief Remembers the full names of Data packets that passed validation.
+ *
+ * Each entry is valid until the earliest expiration of the certificates that verified the packet.
+ * All entries are dropped when the version of the trust anchors they were validated with changes.
+ * When the cache is full, the least recently used entry is evicted.
+ */
+class ValidationResultCache : noncopyable
+{
+public:
+  /**
+   * @pre capacity > 0
+   */
+  explicit
+  ValidationResultCache(size_t capacity);
+
+  size_t
+  getCapacity() const
+  {
+    return m_capacity;
+  }
+
+  size_t
+  size() const
+  {
+    return m_entries.size();
+  }
+
+  /**
+   * @brief Check whether a Data packet named @p fullName has been validated and is still valid
+   * @param anchorsVersion current version of the trust anchors
+   */
+  bool
+  find(const Name& fullName, uint64_t anchorsVersion);
+
+  /**
+   * @brief Record that a Data packet named @p fullName was validated
+   * @param expiry earliest expiration of the certificates that verified the packet
+   * @param anchorsVersion current version of the trust anchors
+   */
+  void
+  insert(const Name& fullName, const time::system_clock::TimePoint& expiry, uint64_t anchorsVersion);
+
+  void
+  clear();
+
+private:
+  void
+  checkAnchorsVersion(uint64_t anchorsVersion);
+
+private:
+  struct Entry
+  {
+    Name fullName;
+    time::system_clock::TimePoint expiry;
+  };
+
+  using EntryContainer = boost::multi_index::multi_index_container<
+    Entry,
+    boost::multi_index::indexed_by<
+      boost::multi_index::sequenced<>,
+      boost::multi_index::hashed_unique<
+        boost::multi_index::member<Entry, Name, &Entry::fullName>,
+        std::hash<Name>
+      >
+    >
+  >;
+
+  const size_t m_capacity;
+  uint64_t m_anchorsVersion = 0;
+  EntryContainer m_entries;
+};
+
+} // namespace detail
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_CXX_SECURITY_IMPL_VALIDATION_RESULT_CACHE_HPP
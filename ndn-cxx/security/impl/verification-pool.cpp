@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/impl/verification-pool.hpp"
+
+#include <boost/asio/io_service.hpp>
+
+namespace ndn {
+namespace security {
+namespace detail {
+
+VerificationPool::VerificationPool(boost::asio::io_service& ioService, size_t nThreads)
+  : m_shared(make_shared<Shared>())
+{
+  BOOST_ASSERT(nThreads > 0);
+  m_threads.reserve(nThreads);
+  for (size_t i = 0; i < nThreads; ++i) {
+    m_threads.emplace_back(&VerificationPool::runWorker, std::ref(ioService), m_shared);
+  }
+}
+
+VerificationPool::~VerificationPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_shared->mutex);
+    m_shared->shouldStop = true;
+  }
+  m_shared->cv.notify_all();
+
+  for (auto& thread : m_threads) {
+    thread.join();
+  }
+  // undelivered jobs are destroyed together with m_shared, on the calling thread
+}
+
+void
+VerificationPool::submit(Verifier verify, Completion complete)
+{
+  auto job = make_unique<Job>();
+  job->verify = std::move(verify);
+  job->complete = std::move(complete);
+  {
+    std::lock_guard<std::mutex> lock(m_shared->mutex);
+    m_shared->queue.push_back(job.get());
+    m_shared->inFlight.push_back(std::move(job));
+  }
+  m_shared->cv.notify_one();
+}
+
+void
+VerificationPool::runWorker(boost::asio::io_service& ioService, shared_ptr<Shared> shared)
+{
+  std::vector<Job*> batch;
+  std::vector<bool> results;
+  batch.reserve(BATCH_SIZE);
+  results.reserve(BATCH_SIZE);
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(shared->mutex);
+      shared->cv.wait(lock, [&] { return shared->shouldStop || !shared->queue.empty(); });
+      if (shared->shouldStop) {
+        return;
+      }
+      while (!shared->queue.empty() && batch.size() < BATCH_SIZE) {
+        batch.push_back(shared->queue.front());
+        shared->queue.pop_front();
+      }
+    }
+
+    // jobs are owned by shared->inFlight and cannot be delivered (and destroyed)
+    // before they are marked as done below
+    for (auto* job : batch) {
+      bool isValid = false;
+      try {
+        isValid = job->verify();
+      }
+      catch (const std::exception&) {
+      }
+      results.push_back(isValid);
+    }
+
+    bool shouldPost = false;
+    {
+      std::lock_guard<std::mutex> lock(shared->mutex);
+      for (size_t i = 0; i < batch.size(); ++i) {
+        batch[i]->result = results[i];
+        batch[i]->isDone = true;
+      }
+      shouldPost = !shared->isDeliveryScheduled;
+      shared->isDeliveryScheduled = true;
+    }
+    batch.clear();
+    results.clear();
+
+    if (shouldPost) {
+      ioService.post([weakShared = weak_ptr<Shared>(shared)] {
+        auto shared = weakShared.lock();
+        if (shared != nullptr) {
+          deliver(*shared);
+        }
+      });
+    }
+  }
+}
+
+void
+VerificationPool::deliver(Shared& shared)
+{
+  std::vector<unique_ptr<Job>> ready;
+  {
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    shared.isDeliveryScheduled = false;
+    while (!shared.inFlight.empty() && shared.inFlight.front()->isDone) {
+      ready.push_back(std::move(shared.inFlight.front()));
+      shared.inFlight.pop_front();
+    }
+  }
+
+  for (const auto& job : ready) {
+    job->complete(job->result);
+  }
+}
+
+} // namespace detail
+} // namespace security
+} // namespace ndn
@@ -0,0 +1,109 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_IMPL_VERIFICATION_POOL_HPP
+#define NDN_CXX_SECURITY_IMPL_VERIFICATION_POOL_HPP
+
+#include "ndn-cxx/detail/asio-fwd.hpp"
+#include "ndn-cxx/detail/common.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace ndn {
+namespace security {
+namespace detail {
+
+/**
+ * @brief Runs signature verifications on a set of worker threads.
+ *
+ * Jobs are submitted on the thread running @p ioService.  Workers take jobs from a shared queue
+ * in batches and run the verification functor, which must not touch any state that is also
+ * accessed by the io thread.  Completion functors are then invoked on the io thread, strictly
+ * in the order in which the jobs were submitted.
+ *
+ * Destroying the pool waits for the running batches to finish; completion functors of jobs
+ * not yet delivered are discarded without being invoked.
+ */
+class VerificationPool : noncopyable
+{
+public:
+  using Verifier = std::function<bool()>;
+  using Completion = std::function<void(bool)>;
+
+  /**
+   * @pre nThreads > 0
+   */
+  VerificationPool(boost::asio::io_service& ioService, size_t nThreads);
+
+  ~VerificationPool();
+
+  size_t
+  getNThreads() const
+  {
+    return m_threads.size();
+  }
+
+  void
+  submit(Verifier verify, Completion complete);
+
+private:
+  struct Job
+  {
+    Verifier verify;
+    Completion complete;
+    bool isDone = false;
+    bool result = false;
+  };
+
+  /// state shared with the workers and with handlers posted to the io thread
+  struct Shared
+  {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<Job*> queue;               ///< jobs not yet taken by a worker
+    std::deque<unique_ptr<Job>> inFlight; ///< all undelivered jobs, in submission order
+    bool isDeliveryScheduled = false;
+    bool shouldStop = false;
+  };
+
+  static void
+  runWorker(boost::asio::io_service& ioService, shared_ptr<Shared> shared);
+
+  static void
+  deliver(Shared& shared);
+
+public:
+  /// maximum number of jobs taken by a worker at once
+  static constexpr size_t BATCH_SIZE = 32;
+
+private:
+  shared_ptr<Shared> m_shared;
+  std::vector<std::thread> m_threads;
+};
+
+} // namespace detail
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_CXX_SECURITY_IMPL_VERIFICATION_POOL_HPP
@@ -25,6 +25,7 @@
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/util/config-file.hpp"
 #include "ndn-cxx/util/logger.hpp"
+#include "ndn-cxx/util/sha256.hpp"
 
 #include "ndn-cxx/security/pib/impl/pib-memory.hpp"
 #include "ndn-cxx/security/pib/impl/pib-sqlite3.hpp"
@@ -37,10 +38,8 @@
 
 #include "ndn-cxx/security/transform/bool-sink.hpp"
 #include "ndn-cxx/security/transform/buffer-source.hpp"
-#include "ndn-cxx/security/transform/digest-filter.hpp"
 #include "ndn-cxx/security/transform/private-key.hpp"
 #include "ndn-cxx/security/transform/public-key.hpp"
-#include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/security/transform/verifier-filter.hpp"
 
 #include <boost/lexical_cast.hpp>
@@ -440,6 +439,15 @@ KeyChain::importPrivateKey(const Name& keyName, shared_ptr<transform::PrivateKey
 
 // public: signing
 
+SigningContext::SigningContext(Name keyName, SignatureInfo sigInfo, DigestAlgorithm digestAlgorithm,
+                               size_t maxSignatureSize)
+  : m_keyName(std::move(keyName))
+  , m_sigInfo(std::move(sigInfo))
+  , m_digestAlgorithm(digestAlgorithm)
+  , m_maxSignatureSize(maxSignatureSize)
+{
+}
+
 void
 KeyChain::sign(Data& data, const SigningInfo& params)
 {
@@ -447,13 +455,70 @@ KeyChain::sign(Data& data, const SigningInfo& params)
   SignatureInfo sigInfo;
   std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
 
+  signData(data, keyName, sigInfo, params.getDigestAlgorithm(),
+           getMaxSignatureSize(sigInfo.getSignatureType()));
+}
+
+SigningContext
+KeyChain::makeSigningContext(const SigningInfo& params)
+{
+  Name keyName;
+  SignatureInfo sigInfo;
+  std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
+
+  size_t keySize = 0;
+  auto sigType = sigInfo.getSignatureType();
+  if (sigType == tlv::SignatureSha256WithRsa || sigType == tlv::SignatureSha256WithEcdsa) {
+    auto publicKeyBits = m_tpm->getPublicKey(keyName);
+    if (publicKeyBits != nullptr) {
+      try {
+        transform::PublicKey publicKey;
+        publicKey.loadPkcs8(*publicKeyBits);
+        keySize = publicKey.getKeySize();
+      }
+      catch (const transform::PublicKey::Error&) {
+        // fall back to the default estimate
+      }
+    }
+  }
+
+  return SigningContext(std::move(keyName), std::move(sigInfo), params.getDigestAlgorithm(),
+                        getMaxSignatureSize(sigType, keySize));
+}
+
+void
+KeyChain::sign(Data& data, const SigningContext& context)
+{
+  signData(data, context.m_keyName, context.m_sigInfo, context.m_digestAlgorithm,
+           context.m_maxSignatureSize);
+}
+
+void
+KeyChain::sign(span<Data> packets, const SigningContext& context)
+{
+  for (auto& data : packets) {
+    sign(data, context);
+  }
+}
+
+void
+KeyChain::signData(Data& data, const Name& keyName, const SignatureInfo& sigInfo,
+                   DigestAlgorithm digestAlgorithm, size_t maxSignatureSize)
+{
   data.setSignatureInfo(sigInfo);
 
-  EncodingBuffer encoder;
+  // size the buffer for the signed portion, the outermost TLV header, and the SignatureValue,
+  // so that the final encoding is produced in place; the encoder grows if the estimate is short
+  EncodingEstimator estimator;
+  size_t signedPortionSize = data.wireEncode(estimator, true);
+  const size_t headerReserve = 8;
+  const size_t sigValueReserve = tlv::sizeOfVarNumber(tlv::SignatureValue) +
+                                 tlv::sizeOfVarNumber(maxSignatureSize) + maxSignatureSize;
+  EncodingBuffer encoder(headerReserve + signedPortionSize + sigValueReserve, sigValueReserve);
   data.wireEncode(encoder, true);
 
-  auto sigValue = sign({encoder}, keyName, params.getDigestAlgorithm());
-  data.wireEncode(encoder, *sigValue);
+  auto sigValue = sign({encoder}, keyName, digestAlgorithm);
+  data.wireEncodeSigned(encoder, *sigValue);
 }
 
 void
@@ -771,12 +836,10 @@ KeyChain::prepareSignatureInfoWithKey(const SigningInfo& params, const pib::Key&
 ConstBufferPtr
 KeyChain::sign(const InputBuffers& bufs, const Name& keyName, DigestAlgorithm digestAlgorithm) const
 {
-  using namespace transform;
-
   if (keyName == SigningInfo::getDigestSha256Identity()) {
-    OBufferStream os;
-    bufferSource(bufs) >> digestFilter(DigestAlgorithm::SHA256) >> streamSink(os);
-    return os.buf();
+    util::Sha256::Digest digest;
+    util::Sha256::computeDigest(bufs, digest);
+    return make_shared<Buffer>(digest.begin(), digest.end());
   }
 
   auto signature = m_tpm->sign(bufs, keyName, digestAlgorithm);
@@ -789,6 +852,27 @@ KeyChain::sign(const InputBuffers& bufs, const Name& keyName, DigestAlgorithm di
   return signature;
 }
 
+size_t
+KeyChain::getMaxSignatureSize(uint32_t sigType, size_t keySize)
+{
+  switch (sigType) {
+    case tlv::DigestSha256:
+      return 32;
+    case tlv::SignatureHmacWithSha256:
+      return 32;
+    case tlv::SignatureSha256WithRsa:
+      // the signature is as long as the modulus
+      return (keySize > 0 ? keySize : 2048) / 8;
+    case tlv::SignatureSha256WithEcdsa: {
+      // DER-encoded SEQUENCE of two INTEGERs, each possibly with a leading zero byte
+      size_t fieldSize = ((keySize > 0 ? keySize : 256) + 7) / 8;
+      return 2 * (fieldSize + 3) + 3;
+    }
+    default:
+      return 128;
+  }
+}
+
 tlv::SignatureTypeValue
 KeyChain::getSignatureType(KeyType keyType, DigestAlgorithm)
 {
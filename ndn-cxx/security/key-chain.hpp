@@ -75,6 +75,53 @@ struct MakeCertificateOptions
 
 inline namespace v2 {
 
+class KeyChain;
+
+/**
+ * @brief Signing parameters resolved in advance by KeyChain::makeSigningContext().
+ *
+ * A SigningContext holds the name of the signing key, the complete SignatureInfo, and the
+ * digest algorithm. Signing with a context does not access the PIB, which makes it suitable
+ * for producers that sign a large number of packets with the same key.
+ *
+ * @note The context is not updated if the PIB changes afterwards, e.g., when the default
+ *       certificate of the key is changed. If the key is deleted from the KeyChain, signing
+ *       with the context fails with KeyChain::InvalidSigningInfoError.
+ */
+class SigningContext
+{
+public:
+  const Name&
+  getKeyName() const noexcept
+  {
+    return m_keyName;
+  }
+
+  const SignatureInfo&
+  getSignatureInfo() const noexcept
+  {
+    return m_sigInfo;
+  }
+
+  DigestAlgorithm
+  getDigestAlgorithm() const noexcept
+  {
+    return m_digestAlgorithm;
+  }
+
+private:
+  SigningContext(Name keyName, SignatureInfo sigInfo, DigestAlgorithm digestAlgorithm,
+                 size_t maxSignatureSize);
+
+private:
+  Name m_keyName;
+  SignatureInfo m_sigInfo;
+  DigestAlgorithm m_digestAlgorithm;
+  size_t m_maxSignatureSize; ///< upper bound of the signature size, to size encoding buffers
+
+  friend KeyChain;
+};
+
 /**
  * @brief The interface of signing key management.
  *
@@ -301,6 +348,43 @@ public: // signing
   void
   sign(Data& data, const SigningInfo& params = SigningInfo());
 
+  /**
+   * @brief Resolve the supplied signing information into a reusable SigningContext.
+   *
+   * This performs the PIB lookups and the SignatureInfo construction of sign(Data&, const SigningInfo&)
+   * once, so that the returned context can be used to sign many Data packets.
+   *
+   * @throw InvalidSigningInfoError Invalid @p params was specified or the specified identity, key,
+   *                                or certificate does not exist
+   */
+  SigningContext
+  makeSigningContext(const SigningInfo& params = SigningInfo());
+
+  /**
+   * @brief Sign a Data packet using a previously resolved SigningContext.
+   *
+   * The result is the same as signing with the SigningInfo that @p context was created from,
+   * but the PIB is not accessed.
+   *
+   * @throw Error Signing failed
+   * @throw InvalidSigningInfoError The signing key no longer exists in the TPM
+   */
+  void
+  sign(Data& data, const SigningContext& context);
+
+  /**
+   * @brief Sign a batch of Data packets using a previously resolved SigningContext.
+   *
+   * Each packet is encoded, signed, and finalized into a single buffer sized in advance for the
+   * signature of the context's key, so that the wire encoding of each packet is produced with
+   * one allocation and without being reparsed.
+   *
+   * @throw Error Signing failed; packets preceding the failed one remain signed
+   * @throw InvalidSigningInfoError The signing key no longer exists in the TPM
+   */
+  void
+  sign(span<Data> packets, const SigningContext& context);
+
   /**
    * @brief Sign an Interest according to the supplied signing information.
    *
@@ -515,6 +599,20 @@ private: // signing
   prepareSignatureInfoWithKey(const SigningInfo& params, const pib::Key& key,
                               optional<Name> certName = nullopt);
 
+  /**
+   * @brief Add @p sigInfo to @p data, then sign and encode it.
+   */
+  void
+  signData(Data& data, const Name& keyName, const SignatureInfo& sigInfo,
+           DigestAlgorithm digestAlgorithm, size_t maxSignatureSize);
+
+  /**
+   * @brief Return an upper bound of the size of a signature of type @p sigType.
+   * @param keySize size of the signing key in bits, or zero to assume a commonly used size
+   */
+  static size_t
+  getMaxSignatureSize(uint32_t sigType, size_t keySize = 0);
+
   /**
    * @brief Generate and return a raw signature for the byte ranges in @p bufs using
    *        the specified key and digest algorithm.
@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/public-key-cache.hpp"
+#include "ndn-cxx/security/certificate.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
+#include "ndn-cxx/util/logger.hpp"
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+
+NDN_LOG_INIT(ndn.security.PublicKeyCache);
+
+PublicKeyCache::PublicKeyCache(size_t limit)
+  : m_limit(limit)
+{
+}
+
+PublicKeyCache::~PublicKeyCache() = default;
+
+shared_ptr<const transform::PublicKey>
+PublicKeyCache::find(const Certificate& cert)
+{
+  const Name& fullName = cert.getFullName();
+
+  auto it = m_index.find(fullName);
+  if (it != m_index.end()) {
+    ++m_nHits;
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    return it->second->second;
+  }
+
+  ++m_nMisses;
+  auto key = make_shared<transform::PublicKey>();
+  try {
+    key->loadPkcs8(cert.getContent().value_bytes());
+  }
+  catch (const transform::PublicKey::Error& e) {
+    NDN_LOG_DEBUG("Cannot parse public key of " << cert.getName() << ": " << e.what());
+    return nullptr;
+  }
+
+  if (m_limit > 0) {
+    m_lru.emplace_front(fullName, key);
+    m_index.emplace(fullName, m_lru.begin());
+    evictExcess();
+  }
+  return key;
+}
+
+void
+PublicKeyCache::erase(const Name& certFullName)
+{
+  auto it = m_index.find(certFullName);
+  if (it != m_index.end()) {
+    m_lru.erase(it->second);
+    m_index.erase(it);
+  }
+}
+
+void
+PublicKeyCache::clear()
+{
+  m_index.clear();
+  m_lru.clear();
+}
+
+void
+PublicKeyCache::setLimit(size_t limit)
+{
+  m_limit = limit;
+  evictExcess();
+}
+
+void
+PublicKeyCache::evictExcess()
+{
+  while (m_index.size() > m_limit) {
+    m_index.erase(m_lru.back().first);
+    m_lru.pop_back();
+  }
+}
+
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_PUBLIC_KEY_CACHE_HPP
+#define NDN_CXX_SECURITY_PUBLIC_KEY_CACHE_HPP
+
+#include "ndn-cxx/name.hpp"
+
+#include <list>
+#include <unordered_map>
+
+namespace ndn {
+namespace security {
+
+namespace transform {
+class PublicKey;
+} // namespace transform
+
+inline namespace v2 {
+
+class Certificate;
+
+/**
+ * @brief Bounded LRU cache of parsed certificate public keys.
+ *
+ * Parsing the PKCS #8 public key carried in a certificate is a significant part of the cost
+ * of signature verification.  This cache keeps the parsed transform::PublicKey objects keyed
+ * by the full name of the certificate (including the implicit digest), so that a certificate
+ * with the same name but different content never shares an entry.
+ *
+ * A single instance is shared by CertificateStorage with its trust anchor container, its
+ * certificate caches, and every ValidationState started by the Validator.
+ */
+class PublicKeyCache : noncopyable
+{
+public:
+  /**
+   * @brief Create a cache holding at most @p limit parsed keys.
+   */
+  explicit
+  PublicKeyCache(size_t limit = getDefaultLimit());
+
+  ~PublicKeyCache();
+
+  /**
+   * @brief Get the parsed public key of @p cert, parsing and caching it on a miss.
+   * @return the parsed key, or nullptr if the certificate does not contain a valid public key
+   */
+  shared_ptr<const transform::PublicKey>
+  find(const Certificate& cert);
+
+  /**
+   * @brief Remove the cached key of the certificate whose full name is @p certFullName.
+   */
+  void
+  erase(const Name& certFullName);
+
+  /**
+   * @brief Remove all cached keys.
+   * @note Hit and miss counters are not reset.
+   */
+  void
+  clear();
+
+  size_t
+  size() const
+  {
+    return m_index.size();
+  }
+
+  size_t
+  getLimit() const
+  {
+    return m_limit;
+  }
+
+  /**
+   * @brief Change the maximum number of cached keys, evicting least recently used entries
+   *        if necessary.
+   */
+  void
+  setLimit(size_t limit);
+
+  /**
+   * @brief Number of find() calls that returned an already parsed key.
+   */
+  uint64_t
+  getNHits() const
+  {
+    return m_nHits;
+  }
+
+  /**
+   * @brief Number of find() calls that required parsing the key.
+   */
+  uint64_t
+  getNMisses() const
+  {
+    return m_nMisses;
+  }
+
+  static constexpr size_t
+  getDefaultLimit()
+  {
+    return 1000;
+  }
+
+private:
+  void
+  evictExcess();
+
+private:
+  using Entry = std::pair<Name, shared_ptr<const transform::PublicKey>>;
+  using Lru = std::list<Entry>;
+
+  Lru m_lru; ///< most recently used entry at the front
+  std::unordered_map<Name, Lru::iterator> m_index;
+  size_t m_limit;
+  uint64_t m_nHits = 0;
+  uint64_t m_nMisses = 0;
+};
+
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_CXX_SECURITY_PUBLIC_KEY_CACHE_HPP
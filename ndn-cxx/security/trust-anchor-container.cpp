@@ -28,21 +28,49 @@ inline namespace v2 {
 void
 TrustAnchorContainer::AnchorContainer::add(Certificate&& cert)
 {
-  AnchorContainerBase::insert(std::move(cert));
+  auto result = AnchorContainerBase::insert(std::move(cert));
+  if (result.second) {
+    ++version;
+  }
+  if (keyCache != nullptr) {
+    // anchors terminate every certificate chain, so parse their keys up front
+    keyCache->find(*result.first);
+  }
 }
 
 void
 TrustAnchorContainer::AnchorContainer::remove(const Name& certName)
 {
-  AnchorContainerBase::erase(certName);
+  auto it = AnchorContainerBase::find(certName);
+  if (it == AnchorContainerBase::end()) {
+    return;
+  }
+  if (keyCache != nullptr) {
+    keyCache->erase(it->getFullName());
+  }
+  AnchorContainerBase::erase(it);
+  ++version;
 }
 
 void
 TrustAnchorContainer::AnchorContainer::clear()
 {
+  if (keyCache != nullptr) {
+    for (const auto& cert : *this) {
+      keyCache->erase(cert.getFullName());
+    }
+  }
+  if (!empty()) {
+    ++version;
+  }
   AnchorContainerBase::clear();
 }
 
+TrustAnchorContainer::TrustAnchorContainer(PublicKeyCache* keyCache)
+{
+  m_anchors.keyCache = keyCache;
+}
+
 void
 TrustAnchorContainer::insert(const std::string& groupId, Certificate&& cert)
 {
@@ -120,6 +148,13 @@ TrustAnchorContainer::size() const
   return m_anchors.size();
 }
 
+uint64_t
+TrustAnchorContainer::getVersion() const
+{
+  const_cast<TrustAnchorContainer*>(this)->refresh();
+  return m_anchors.version;
+}
+
 void
 TrustAnchorContainer::refresh()
 {
@@ -24,6 +24,7 @@
 
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/security/certificate.hpp"
+#include "ndn-cxx/security/public-key-cache.hpp"
 #include "ndn-cxx/security/trust-anchor-group.hpp"
 
 #include <boost/multi_index_container.hpp>
@@ -61,6 +62,15 @@ public:
     using std::runtime_error::runtime_error;
   };
 
+  /**
+   * @brief Create an empty container.
+   * @param keyCache if not nullptr, public keys of anchors are parsed into this cache when the
+   *                 anchors are added and dropped when they are removed; it must outlive the
+   *                 container
+   */
+  explicit
+  TrustAnchorContainer(PublicKeyCache* keyCache = nullptr);
+
   /**
    * @brief Insert a static trust anchor.
    *
@@ -132,6 +142,15 @@ public:
   size_t
   size() const;
 
+  /**
+   * @brief Get a number that changes every time an anchor is added or removed
+   *
+   * Dynamic anchor groups are refreshed first, as in `find` methods, so that a change of the
+   * underlying files is reflected in the returned value.
+   */
+  uint64_t
+  getVersion() const;
+
 private:
   void
   refresh();
@@ -158,6 +177,10 @@ private:
 
     void
     clear();
+
+  public:
+    PublicKeyCache* keyCache = nullptr;
+    uint64_t version = 0;
   };
 
   using GroupContainer = boost::multi_index::multi_index_container<
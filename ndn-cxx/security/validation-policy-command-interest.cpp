@@ -87,6 +87,9 @@ ValidationPolicyCommandInterest::parseCommandInterest(const Interest& interest,
 
   if (*fmt == SignedInterestFormat::V03) {
     BOOST_ASSERT(interest.getSignatureInfo());
+    if (!checkParametersDigest(interest, *state)) {
+      return std::make_tuple(false, Name(), time::system_clock::TimePoint{});
+    }
     auto optionalTimestamp = interest.getSignatureInfo()->getTime();
 
     // Note that timestamp is a hard requirement of this policy
@@ -79,6 +79,9 @@ ValidationPolicyConfig::load(const ConfigSection& configSection, const std::stri
     m_shouldBypass = false;
     m_dataRules.clear();
     m_interestRules.clear();
+    m_dataRuleIndex.clear();
+    m_interestRuleIndex.clear();
+    m_acceptedDecisions.clear();
     m_validator->resetAnchors();
     m_validator->resetVerifiedCertificates();
   }
@@ -91,9 +94,11 @@ ValidationPolicyConfig::load(const ConfigSection& configSection, const std::stri
     if (boost::iequals(sectionName, "rule")) {
       auto rule = Rule::create(section, filename);
       if (rule->getPktType() == tlv::Data) {
+        m_dataRuleIndex.insert(*rule, m_dataRules.size());
         m_dataRules.push_back(std::move(rule));
       }
       else if (rule->getPktType() == tlv::Interest) {
+        m_interestRuleIndex.insert(*rule, m_interestRules.size());
         m_interestRules.push_back(std::move(rule));
       }
     }
@@ -231,6 +236,15 @@ ValidationPolicyConfig::getDefaultRefreshPeriod()
   return 1_h;
 }
 
+void
+ValidationPolicyConfig::rememberAcceptedDecision(Decision decision)
+{
+  if (m_acceptedDecisions.size() >= MAX_ACCEPTED_DECISIONS) {
+    m_acceptedDecisions.clear();
+  }
+  m_acceptedDecisions.insert(std::move(decision));
+}
+
 void
 ValidationPolicyConfig::checkPolicy(const Data& data, const shared_ptr<ValidationState>& state,
                                     const ValidationContinuation& continueValidation)
@@ -246,10 +260,17 @@ ValidationPolicyConfig::checkPolicy(const Data& data, const shared_ptr<Validatio
     return;
   }
 
-  for (const auto& rule : m_dataRules) {
+  auto sigType = tlv::SignatureTypeValue(data.getSignatureType());
+  Decision decision{tlv::Data, sigType, data.getName(), klName};
+  if (m_acceptedDecisions.count(decision) > 0) {
+    return continueValidation(make_shared<CertificateRequest>(klName), state);
+  }
+
+  for (size_t pos : m_dataRuleIndex.find(data.getName())) {
+    const auto& rule = m_dataRules[pos];
     if (rule->match(tlv::Data, data.getName(), state)) {
-      if (rule->check(tlv::Data, tlv::SignatureTypeValue(data.getSignatureType()),
-                      data.getName(), klName, state)) {
+      if (rule->check(tlv::Data, sigType, data.getName(), klName, state)) {
+        rememberAcceptedDecision(std::move(decision));
         return continueValidation(make_shared<CertificateRequest>(klName), state);
       }
       // rule->check calls state->fail(...) if the check fails
@@ -276,12 +297,27 @@ ValidationPolicyConfig::checkPolicy(const Interest& interest, const shared_ptr<V
     return;
   }
 
-  for (const auto& rule : m_interestRules) {
-    if (rule->match(tlv::Interest, interest.getName(), state)) {
+  auto fmt = state->getTag<SignedInterestFormatTag>();
+  BOOST_ASSERT(fmt);
+
+  // only the v0.3 format is remembered, its signature type is known without decoding the name
+  optional<Decision> decision;
+  const Name& pktName = interest.getName();
+  if (*fmt == SignedInterestFormat::V03 && interest.getSignatureInfo() &&
+      !pktName.empty() && pktName[-1].type() == tlv::ParametersSha256DigestComponent) {
+    decision.emplace(tlv::Interest,
+                     tlv::SignatureTypeValue(interest.getSignatureInfo()->getSignatureType()),
+                     pktName.getPrefix(-1), klName);
+    if (m_acceptedDecisions.count(*decision) > 0) {
+      return continueValidation(make_shared<CertificateRequest>(klName), state);
+    }
+  }
+
+  for (size_t pos : m_interestRuleIndex.find(pktName)) {
+    const auto& rule = m_interestRules[pos];
+    if (rule->match(tlv::Interest, pktName, state)) {
 
       tlv::SignatureTypeValue sigType;
-      auto fmt = state->getTag<SignedInterestFormatTag>();
-      BOOST_ASSERT(fmt);
 
       if (*fmt == SignedInterestFormat::V03) {
         sigType = tlv::SignatureTypeValue(interest.getSignatureInfo()->getSignatureType());
@@ -305,7 +341,10 @@ ValidationPolicyConfig::checkPolicy(const Interest& interest, const shared_ptr<V
         sigType = tlv::SignatureTypeValue(si.getSignatureType());
       }
 
-      if (rule->check(tlv::Interest, sigType, interest.getName(), klName, state)) {
+      if (rule->check(tlv::Interest, sigType, pktName, klName, state)) {
+        if (decision) {
+          rememberAcceptedDecision(std::move(*decision));
+        }
         return continueValidation(make_shared<CertificateRequest>(klName), state);
       }
       // rule->check calls state->fail(...) if the check fails
@@ -24,6 +24,10 @@
 
 #include "ndn-cxx/security/validation-policy.hpp"
 #include "ndn-cxx/security/validator-config/rule.hpp"
+#include "ndn-cxx/security/validator-config/rule-index.hpp"
+
+#include <set>
+#include <tuple>
 
 namespace ndn {
 namespace security {
@@ -36,6 +40,10 @@ namespace validator_config {
  * @note For command Interest validation, this policy must be combined with
  *       @p ValidationPolicyCommandInterest, in order to guard against replay attacks.
  * @note This policy does not support inner policies (a sole policy or a terminal inner policy)
+ *
+ * Rules are indexed by the name prefix that their filters require, so that only the rules that
+ * can match a packet name are tried. Accepted combinations of packet name and KeyLocator are
+ * remembered, so that validating the same packet again does not evaluate the rules again.
  * @sa https://named-data.net/doc/ndn-cxx/current/tutorials/security-validator-config.html
  */
 class ValidationPolicyConfig : public ValidationPolicy
@@ -88,6 +96,16 @@ private:
   time::nanoseconds
   getDefaultRefreshPeriod();
 
+  /**
+   * @brief (packet type, signature type, packet name as seen by the rules, KeyLocator name)
+   *
+   * The outcome of the rules only depends on these values.
+   */
+  using Decision = std::tuple<uint32_t, tlv::SignatureTypeValue, Name, Name>;
+
+  void
+  rememberAcceptedDecision(Decision decision);
+
 NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /** @brief Whether to always bypass validation.
    *
@@ -99,6 +117,11 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
   std::vector<unique_ptr<Rule>> m_dataRules;
   std::vector<unique_ptr<Rule>> m_interestRules;
+  RuleIndex m_dataRuleIndex;
+  RuleIndex m_interestRuleIndex;
+
+  std::set<Decision> m_acceptedDecisions;
+  static constexpr size_t MAX_ACCEPTED_DECISIONS = 1024;
 };
 
 } // namespace validator_config
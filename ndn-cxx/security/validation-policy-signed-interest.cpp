@@ -70,6 +70,10 @@ bool
 ValidationPolicySignedInterest::checkIncomingInterest(const shared_ptr<ValidationState>& state,
                                                       const Interest& interest)
 {
+  if (!checkParametersDigest(interest, *state)) {
+    return false;
+  }
+
   // Extract information from Interest
   BOOST_ASSERT(interest.getSignatureInfo());
   Name keyName = getKeyLocatorName(interest, *state);
@@ -118,6 +118,17 @@ getKeyLocatorName(const Interest& interest, ValidationState& state)
   return getKeyLocatorName(si, state);
 }
 
+bool
+checkParametersDigest(const Interest& interest, ValidationState& state)
+{
+  if (!interest.isParametersDigestValid()) {
+    state.fail({ValidationError::Code::POLICY_ERROR, "ParametersSha256DigestComponent of `" +
+                interest.getName().toUri() + "` does not match the Interest parameters"});
+    return false;
+  }
+  return true;
+}
+
 Name
 extractIdentityNameFromKeyLocator(const Name& keyLocator)
 {
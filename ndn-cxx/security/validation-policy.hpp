@@ -168,6 +168,18 @@ getKeyLocatorName(const Data& data, ValidationState& state);
 Name
 getKeyLocatorName(const Interest& interest, ValidationState& state);
 
+/** \brief check the ParametersSha256DigestComponent of an Interest
+ *
+ *  The signature of a signed Interest covers the parameters but not the digest component, so an
+ *  Interest decoded without the digest check (see Face::setParametersDigestCheckDeferred) must be
+ *  checked before it can be trusted. The result is cached in the Interest, therefore this is cheap
+ *  when the digest was already verified during decoding.
+ *
+ *  \return whether the digest is valid; otherwise, state.fail is invoked with POLICY_ERROR
+ */
+bool
+checkParametersDigest(const Interest& interest, ValidationState& state);
+
 /**
  * @brief Extract identity name from key, version-less certificate, or certificate name
  *
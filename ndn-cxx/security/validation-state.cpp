@@ -20,6 +20,8 @@
  */
 
 #include "ndn-cxx/security/validation-state.hpp"
+#include "ndn-cxx/security/public-key-cache.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
 #include "ndn-cxx/security/validator.hpp"
 #include "ndn-cxx/security/verification-helpers.hpp"
 #include "ndn-cxx/util/logger.hpp"
@@ -33,6 +35,27 @@ NDN_LOG_INIT(ndn.security.ValidationState);
 #define NDN_LOG_DEBUG_DEPTH(x) NDN_LOG_DEBUG(std::string(this->getDepth() + 1, '>') << " " << x)
 #define NDN_LOG_TRACE_DEPTH(x) NDN_LOG_TRACE(std::string(this->getDepth() + 1, '>') << " " << x)
 
+template<typename Packet>
+static bool
+verifyWithKeyCache(const Packet& packet, const Certificate& cert, PublicKeyCache* keyCache)
+{
+  if (keyCache == nullptr) {
+    return verifySignature(packet, cert);
+  }
+  auto key = keyCache->find(cert);
+  return key != nullptr && verifySignature(packet, *key);
+}
+
+template<typename Packet>
+static bool
+verifyWithKeyCache(const Packet& packet, const optional<Certificate>& cert, PublicKeyCache* keyCache)
+{
+  if (!cert) {
+    return verifySignature(packet, nullopt);
+  }
+  return verifyWithKeyCache(packet, *cert, keyCache);
+}
+
 ValidationState::ValidationState()
   : m_outcome(boost::logic::indeterminate)
 {
@@ -69,7 +92,7 @@ ValidationState::verifyCertificateChain(const Certificate& trustedCert)
   for (auto it = m_certificateChain.begin(); it != m_certificateChain.end(); ++it) {
     const auto& certToValidate = *it;
 
-    if (!verifySignature(certToValidate, *validatedCert)) {
+    if (!verifyWithKeyCache(certToValidate, *validatedCert, m_publicKeyCache)) {
       this->fail({ValidationError::Code::INVALID_SIGNATURE, "Invalid signature of certificate `" +
                   certToValidate.getName().toUri() + "`"});
       m_certificateChain.erase(it, m_certificateChain.end());
@@ -107,7 +130,19 @@ DataValidationState::~DataValidationState()
 void
 DataValidationState::verifyOriginalPacket(const optional<Certificate>& trustedCert)
 {
-  if (verifySignature(m_data, trustedCert)) {
+  finishOriginalPacket(verifyWithKeyCache(m_data, trustedCert, m_publicKeyCache));
+}
+
+bool
+DataValidationState::verifyOriginalSignature(const transform::PublicKey& key) const
+{
+  return verifySignature(m_data, key);
+}
+
+void
+DataValidationState::finishOriginalPacket(bool isSignatureValid)
+{
+  if (isSignatureValid) {
     NDN_LOG_TRACE_DEPTH("OK signature for data `" << m_data.getName() << "`");
     m_successCb(m_data);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
@@ -167,7 +202,19 @@ InterestValidationState::~InterestValidationState()
 void
 InterestValidationState::verifyOriginalPacket(const optional<Certificate>& trustedCert)
 {
-  if (verifySignature(m_interest, trustedCert)) {
+  finishOriginalPacket(verifyWithKeyCache(m_interest, trustedCert, m_publicKeyCache));
+}
+
+bool
+InterestValidationState::verifyOriginalSignature(const transform::PublicKey& key) const
+{
+  return verifySignature(m_interest, key);
+}
+
+void
+InterestValidationState::finishOriginalPacket(bool isSignatureValid)
+{
+  if (isSignatureValid) {
     NDN_LOG_TRACE_DEPTH("OK signature for interest `" << m_interest.getName() << "`");
     this->afterSuccess(m_interest);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
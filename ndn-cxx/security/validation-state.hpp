@@ -34,8 +34,14 @@
 
 namespace ndn {
 namespace security {
+
+namespace transform {
+class PublicKey;
+} // namespace transform
+
 inline namespace v2 {
 
+class PublicKeyCache;
 class Validator;
 
 /**
@@ -115,6 +121,22 @@ private: // Interface intended to be used only by Validator class
   virtual void
   verifyOriginalPacket(const optional<Certificate>& trustedCert) = 0;
 
+  /**
+   * @brief Verify signature of the original packet using @p key without invoking any callback
+   *
+   * This method may be called on a verification worker thread of the Validator, concurrently
+   * with the thread that owns the state; it must not modify the state.
+   */
+  virtual bool
+  verifyOriginalSignature(const transform::PublicKey& key) const = 0;
+
+  /**
+   * @brief Call success or failure callback of the original packet depending on the result
+   *        of verifyOriginalSignature()
+   */
+  virtual void
+  finishOriginalPacket(bool isSignatureValid) = 0;
+
   /**
    * @brief Call success callback of the original packet without signature validation
    */
@@ -141,6 +163,9 @@ private: // Interface intended to be used only by Validator class
 protected:
   boost::logic::tribool m_outcome;
 
+  /// cache of parsed public keys owned by the Validator, nullptr if not set
+  PublicKeyCache* m_publicKeyCache = nullptr;
+
 private:
   std::unordered_set<Name> m_seenCertificateNames;
 
@@ -152,6 +177,13 @@ private:
    */
   std::list<Certificate> m_certificateChain;
 
+  /**
+   * @brief earliest expiration of the certificates that verified the original packet
+   *
+   * Set by Validator once the certificate chain is trusted, if it keeps validation results.
+   */
+  optional<time::system_clock::TimePoint> m_chainExpiry;
+
   friend Validator;
 };
 
@@ -192,6 +224,12 @@ private:
   void
   verifyOriginalPacket(const optional<Certificate>& trustedCert) final;
 
+  bool
+  verifyOriginalSignature(const transform::PublicKey& key) const final;
+
+  void
+  finishOriginalPacket(bool isSignatureValid) final;
+
   void
   bypassValidation() final;
 
@@ -241,6 +279,12 @@ private:
   void
   verifyOriginalPacket(const optional<Certificate>& trustedCert) final;
 
+  bool
+  verifyOriginalSignature(const transform::PublicKey& key) const final;
+
+  void
+  finishOriginalPacket(bool isSignatureValid) final;
+
   void
   bypassValidation() final;
 
@@ -69,15 +69,28 @@ Checker::reject()
   return NegativeResultBuilder();
 }
 
-Checker::Result
-Checker::check(uint32_t pktType, tlv::SignatureTypeValue sigType, const Name& pktName, const Name& klName,
-               const ValidationState& state)
+/**
+ * @brief Checks shared by Checker::check() and Checker::passes()
+ *
+ * Verifies the signature type, and strips the signed Interest components from the name of an
+ * Interest, before handing the names over to @p checkNames.
+ *
+ * @param reject invoked with a function that writes the reason of the rejection to a stream,
+ *               if the packet is rejected before its names are checked
+ * @param checkNames invoked with the packet name to be checked and the KeyLocator name
+ */
+template<typename Reject, typename CheckNames>
+static auto
+checkPacket(uint32_t pktType, tlv::SignatureTypeValue sigType, tlv::SignatureTypeValue expectedSigType,
+            const Name& pktName, const Name& klName, const ValidationState& state,
+            const Reject& reject, const CheckNames& checkNames)
 {
   BOOST_ASSERT(pktType == tlv::Interest || pktType == tlv::Data);
 
-  if (sigType != m_sigType) {
-    return reject() << "signature type does not match the checker "
-                    << sigType << " != " << m_sigType;
+  if (sigType != expectedSigType) {
+    return reject([=] (auto& os) {
+      os << "signature type does not match the checker " << sigType << " != " << expectedSigType;
+    });
   }
 
   if (pktType == tlv::Interest) {
@@ -88,13 +101,13 @@ Checker::check(uint32_t pktType, tlv::SignatureTypeValue sigType, const Name& pk
       // This check is redundant if parameter digest checking is enabled. However, the parameter
       // digest checking can be disabled in API.
       if (pktName.size() == 0 || pktName[-1].type() != tlv::ParametersSha256DigestComponent) {
-        return reject() << "ParametersSha256DigestComponent missing";
+        return reject([] (auto& os) { os << "ParametersSha256DigestComponent missing"; });
       }
       return checkNames(pktName.getPrefix(-1), klName);
     }
     else {
       if (pktName.size() < signed_interest::MIN_SIZE)
-        return reject() << "name too short";
+        return reject([] (auto& os) { os << "name too short"; });
 
       return checkNames(pktName.getPrefix(-signed_interest::MIN_SIZE), klName);
     }
@@ -104,10 +117,45 @@ Checker::check(uint32_t pktType, tlv::SignatureTypeValue sigType, const Name& pk
   }
 }
 
+Checker::Result
+Checker::check(uint32_t pktType, tlv::SignatureTypeValue sigType, const Name& pktName, const Name& klName,
+               const ValidationState& state)
+{
+  return checkPacket(pktType, sigType, m_sigType, pktName, klName, state,
+                     [] (const auto& formatReason) -> Result {
+                       NegativeResultBuilder result = reject();
+                       formatReason(result);
+                       return result;
+                     },
+                     [this] (const Name& name, const Name& keyLocatorName) {
+                       return checkNames(name, keyLocatorName);
+                     });
+}
+
+bool
+Checker::passes(uint32_t pktType, tlv::SignatureTypeValue sigType, const Name& pktName,
+                const Name& klName, const ValidationState& state)
+{
+  return checkPacket(pktType, sigType, m_sigType, pktName, klName, state,
+                     [] (const auto&) { return false; },
+                     [this] (const Name& name, const Name& keyLocatorName) {
+                       return matchNames(name, keyLocatorName);
+                     });
+}
+
 Checker::Result
 Checker::checkNames(const Name& pktName, const Name& klName)
 {
-  return accept();
+  if (matchNames(pktName, klName)) {
+    return accept();
+  }
+  return reject();
+}
+
+bool
+Checker::matchNames(const Name& pktName, const Name& klName)
+{
+  return true;
 }
 
 NameRelationChecker::NameRelationChecker(tlv::SignatureTypeValue sigType, const Name& name, const NameRelation& relation)
@@ -117,17 +165,22 @@ NameRelationChecker::NameRelationChecker(tlv::SignatureTypeValue sigType, const
 {
 }
 
+bool
+NameRelationChecker::matchNames(const Name& pktName, const Name& klName)
+{
+  // pktName not used in this check
+  return checkNameRelation(m_relation, m_name, extractIdentityNameFromKeyLocator(klName));
+}
+
 Checker::Result
 NameRelationChecker::checkNames(const Name& pktName, const Name& klName)
 {
-  // pktName not used in this check
-  Name identity = extractIdentityNameFromKeyLocator(klName);
-  if (checkNameRelation(m_relation, m_name, identity)) {
+  if (matchNames(pktName, klName)) {
     return accept();
   }
 
-  return reject() << "identity " << identity << " and packet name do not satisfy "
-                  << m_relation << " relation";
+  return reject() << "identity " << extractIdentityNameFromKeyLocator(klName)
+                  << " and packet name do not satisfy " << m_relation << " relation";
 }
 
 RegexChecker::RegexChecker(tlv::SignatureTypeValue sigType, const Regex& regex)
@@ -139,13 +192,19 @@ RegexChecker::RegexChecker(tlv::SignatureTypeValue sigType, const Regex& regex)
 Checker::Result
 RegexChecker::checkNames(const Name& pktName, const Name& klName)
 {
-  if (m_regex.match(klName)) {
+  if (matchNames(pktName, klName)) {
     return accept();
   }
 
   return reject() << "KeyLocator does not match regex " << m_regex;
 }
 
+bool
+RegexChecker::matchNames(const Name& pktName, const Name& klName)
+{
+  return m_regex.doesMatch(klName);
+}
+
 HyperRelationChecker::HyperRelationChecker(tlv::SignatureTypeValue sigType,
                                            const std::string& pktNameExpr, const std::string pktNameExpand,
                                            const std::string& klNameExpr, const std::string klNameExpand,
@@ -160,6 +219,11 @@ HyperRelationChecker::HyperRelationChecker(tlv::SignatureTypeValue sigType,
 Checker::Result
 HyperRelationChecker::checkNames(const Name& pktName, const Name& klName)
 {
+  if (matchNames(pktName, klName)) {
+    return accept();
+  }
+
+  // matchNames() stops at the first unsatisfied condition, so the regexes may need rematching
   if (!m_hyperPRegex.match(pktName)) {
     return reject() << "packet name does not match p-regex " << m_hyperPRegex;
   }
@@ -168,16 +232,17 @@ HyperRelationChecker::checkNames(const Name& pktName, const Name& klName)
     return reject() << "KeyLocator does not match k-regex " << m_hyperKRegex;
   }
 
-  auto kExpand = m_hyperKRegex.expand();
-  auto pExpand = m_hyperPRegex.expand();
-  if (checkNameRelation(m_hyperRelation, kExpand, pExpand)) {
-    return accept();
-  }
-
-  return reject() << "expanded names " << kExpand << " and " << pExpand
+  return reject() << "expanded names " << m_hyperKRegex.expand() << " and " << m_hyperPRegex.expand()
                   << " do not satisfy " << m_hyperRelation << " relation";
 }
 
+bool
+HyperRelationChecker::matchNames(const Name& pktName, const Name& klName)
+{
+  return m_hyperPRegex.match(pktName) && m_hyperKRegex.match(klName) &&
+         checkNameRelation(m_hyperRelation, m_hyperKRegex.expand(), m_hyperPRegex.expand());
+}
+
 unique_ptr<Checker>
 Checker::create(const ConfigSection& configSection, const std::string& configFilename)
 {
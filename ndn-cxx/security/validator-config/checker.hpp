@@ -90,6 +90,17 @@ public:
   check(uint32_t pktType, tlv::SignatureTypeValue sigType,
         const Name& pktName, const Name& klName, const ValidationState& state);
 
+  /**
+   * @brief Check if packet name and KeyLocator satisfy the checker's conditions,
+   *        without building an error message
+   *
+   * Returns the same outcome as check(). It is meant for the common case where the reason of a
+   * failed check is not needed.
+   */
+  bool
+  passes(uint32_t pktType, tlv::SignatureTypeValue sigType,
+         const Name& pktName, const Name& klName, const ValidationState& state);
+
   /**
    * @brief create a checker from configuration section
    *
@@ -102,12 +113,21 @@ public:
 
 protected:
   /**
-   * @brief Base version of name checking
-   * @return always returns accept()
+   * @brief Name checking used by check()
+   *
+   * The base version returns the outcome of matchNames() with a generic error message.
+   * Subclasses only override it to explain why matchNames() failed.
    */
   virtual Result
   checkNames(const Name& pktName, const Name& klName);
 
+  /**
+   * @brief Name matching used by passes() and checkNames()
+   * @return the base version always returns true
+   */
+  virtual bool
+  matchNames(const Name& pktName, const Name& klName);
+
   static Result
   accept()
   {
@@ -147,6 +167,9 @@ protected:
   Result
   checkNames(const Name& pktName, const Name& klName) override;
 
+  bool
+  matchNames(const Name& pktName, const Name& klName) override;
+
 private:
   Name m_name;
   NameRelation m_relation;
@@ -162,6 +185,9 @@ protected:
   Result
   checkNames(const Name& pktName, const Name& klName) override;
 
+  bool
+  matchNames(const Name& pktName, const Name& klName) override;
+
 private:
   Regex m_regex;
 };
@@ -178,6 +204,9 @@ protected:
   Result
   checkNames(const Name& pktName, const Name& klName) override;
 
+  bool
+  matchNames(const Name& pktName, const Name& klName) override;
+
 private:
   Regex m_hyperPRegex;
   Regex m_hyperKRegex;
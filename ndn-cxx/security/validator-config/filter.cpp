@@ -64,12 +64,25 @@ Filter::match(uint32_t pktType, const Name& pktName, const shared_ptr<Validation
   }
 }
 
+Name
+Filter::getNamePrefix() const
+{
+  return Name();
+}
+
 RelationNameFilter::RelationNameFilter(const Name& name, NameRelation relation)
   : m_name(name)
   , m_relation(relation)
 {
 }
 
+Name
+RelationNameFilter::getNamePrefix() const
+{
+  // every supported relation requires m_name to be a prefix of the packet name
+  return m_name;
+}
+
 bool
 RelationNameFilter::matchName(const Name& name)
 {
@@ -81,10 +94,16 @@ RegexNameFilter::RegexNameFilter(const Regex& regex)
 {
 }
 
+Name
+RegexNameFilter::getNamePrefix() const
+{
+  return m_regex.getLiteralPrefix();
+}
+
 bool
 RegexNameFilter::matchName(const Name& name)
 {
-  return m_regex.match(name);
+  return m_regex.doesMatch(name);
 }
 
 unique_ptr<Filter>
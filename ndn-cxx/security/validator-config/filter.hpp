@@ -52,6 +52,14 @@ public:
   bool
   match(uint32_t pktType, const Name& pktName, const shared_ptr<ValidationState>& state);
 
+  /**
+   * @brief Return a prefix of every packet name that the filter can match
+   *
+   * The default implementation returns an empty name, i.e., the filter may match any name.
+   */
+  virtual Name
+  getNamePrefix() const;
+
 public:
   /**
    * @brief Create a filter from the configuration section
@@ -95,6 +103,9 @@ class RelationNameFilter : public Filter
 public:
   RelationNameFilter(const Name& name, NameRelation relation);
 
+  Name
+  getNamePrefix() const override;
+
 private:
   bool
   matchName(const Name& pktName) override;
@@ -129,6 +140,9 @@ public:
   explicit
   RegexNameFilter(const Regex& regex);
 
+  Name
+  getNamePrefix() const override;
+
 private:
   bool
   matchName(const Name& pktName) override;
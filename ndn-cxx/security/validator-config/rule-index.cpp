@@ -0,0 +1,73 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/validator-config/rule-index.hpp"
+
+#include <algorithm>
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+namespace validator_config {
+
+void
+RuleIndex::insert(const Rule& rule, size_t pos)
+{
+  Node* node = &m_root;
+  for (const auto& component : rule.getNamePrefix()) {
+    auto& child = node->children[component];
+    if (child == nullptr) {
+      child = make_unique<Node>();
+    }
+    node = child.get();
+  }
+  node->positions.push_back(pos);
+}
+
+std::vector<size_t>
+RuleIndex::find(const Name& pktName) const
+{
+  std::vector<size_t> positions(m_root.positions);
+  const Node* node = &m_root;
+  for (const auto& component : pktName) {
+    auto it = node->children.find(component);
+    if (it == node->children.end()) {
+      break;
+    }
+    node = it->second.get();
+    positions.insert(positions.end(), node->positions.begin(), node->positions.end());
+  }
+
+  std::sort(positions.begin(), positions.end());
+  return positions;
+}
+
+void
+RuleIndex::clear()
+{
+  m_root.children.clear();
+  m_root.positions.clear();
+}
+
+} // namespace validator_config
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
@@ -0,0 +1,75 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_VALIDATOR_CONFIG_RULE_INDEX_HPP
+#define NDN_CXX_SECURITY_VALIDATOR_CONFIG_RULE_INDEX_HPP
+
+#include "ndn-cxx/security/validator-config/rule.hpp"
+
+#include <map>
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+namespace validator_config {
+
+/**
+ * @brief Index of an ordered list of rules by the name prefix that each rule requires
+ *
+ * The index is a tree of name components. Each rule is stored at the node of its
+ * Rule::getNamePrefix(), so looking up a packet name only visits the rules that can match it,
+ * instead of trying every rule of the list.
+ */
+class RuleIndex : noncopyable
+{
+public:
+  /**
+   * @brief Add @p rule, which is at position @p pos in the rule list
+   * @pre Rules are inserted in increasing order of position.
+   */
+  void
+  insert(const Rule& rule, size_t pos);
+
+  /**
+   * @brief Return the positions of the rules that can match @p pktName, in increasing order
+   */
+  std::vector<size_t>
+  find(const Name& pktName) const;
+
+  void
+  clear();
+
+private:
+  struct Node
+  {
+    std::map<name::Component, unique_ptr<Node>> children;
+    std::vector<size_t> positions;
+  };
+
+  Node m_root;
+};
+
+} // namespace validator_config
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_CXX_SECURITY_VALIDATOR_CONFIG_RULE_INDEX_HPP
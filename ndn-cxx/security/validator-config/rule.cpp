@@ -50,6 +50,25 @@ Rule::addChecker(unique_ptr<Checker> checker)
   m_checkers.push_back(std::move(checker));
 }
 
+Name
+Rule::getNamePrefix() const
+{
+  if (m_filters.empty()) {
+    return Name();
+  }
+
+  Name prefix = m_filters.front()->getNamePrefix();
+  for (const auto& filter : m_filters) {
+    Name filterPrefix = filter->getNamePrefix();
+    size_t len = 0;
+    while (len < prefix.size() && len < filterPrefix.size() && prefix[len] == filterPrefix[len]) {
+      ++len;
+    }
+    prefix = prefix.getPrefix(len);
+  }
+  return prefix;
+}
+
 bool
 Rule::match(uint32_t pktType, const Name& pktName, const shared_ptr<ValidationState>& state) const
 {
@@ -84,20 +103,18 @@ Rule::check(uint32_t pktType, tlv::SignatureTypeValue sigType, const Name& pktNa
                     " != " + to_string(m_pktType) + ")"));
   }
 
-  std::vector<Checker::Result> checkerResults;
-  checkerResults.reserve(m_checkers.size());
   for (const auto& checker : m_checkers) {
-    auto result = checker->check(pktType, sigType, pktName, klName, *state);
-    if (result) {
+    if (checker->passes(pktType, sigType, pktName, klName, *state)) {
       return true;
     }
-    checkerResults.push_back(std::move(result));
   }
 
+  // error messages are only needed when the packet cannot pass any checker
   std::ostringstream err;
   err << "Packet " << pktName << " (KeyLocator=" << klName << ") cannot pass any checker.";
-  for (size_t i = 0; i < checkerResults.size(); ++i) {
-    err << "\nChecker " << i << ": " << checkerResults[i].getErrorMessage();
+  for (size_t i = 0; i < m_checkers.size(); ++i) {
+    auto result = m_checkers[i]->check(pktType, sigType, pktName, klName, *state);
+    err << "\nChecker " << i << ": " << result.getErrorMessage();
   }
   state->fail({ValidationError::POLICY_ERROR, err.str()});
   return false;
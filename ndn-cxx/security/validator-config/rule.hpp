@@ -56,6 +56,15 @@ public:
   void
   addChecker(unique_ptr<Checker> checker);
 
+  /**
+   * @brief Return a prefix of every packet name that the rule can match
+   *
+   * This is the longest common prefix of the filters' name prefixes. It is empty if the rule
+   * has no filters, i.e., if the rule matches everything.
+   */
+  Name
+  getNamePrefix() const;
+
   /**
    * @brief check if the packet name matches rule's filter
    *
@@ -22,6 +22,8 @@
 #include "ndn-cxx/security/validator.hpp"
 
 #include "ndn-cxx/face.hpp"
+#include "ndn-cxx/security/impl/validation-result-cache.hpp"
+#include "ndn-cxx/security/impl/verification-pool.hpp"
 #include "ndn-cxx/security/transform/public-key.hpp"
 #include "ndn-cxx/util/logger.hpp"
 
@@ -34,6 +36,17 @@ NDN_LOG_INIT(ndn.security.Validator);
 #define NDN_LOG_DEBUG_DEPTH(x) NDN_LOG_DEBUG(std::string(state->getDepth() + 1, '>') << " " << x)
 #define NDN_LOG_TRACE_DEPTH(x) NDN_LOG_TRACE(std::string(state->getDepth() + 1, '>') << " " << x)
 
+static optional<time::system_clock::TimePoint>
+getNotAfter(const Certificate& cert)
+{
+  try {
+    return cert.getValidityPeriod().getPeriod().second;
+  }
+  catch (const tlv::Error&) {
+    return nullopt;
+  }
+}
+
 Validator::Validator(unique_ptr<ValidationPolicy> policy, unique_ptr<CertificateFetcher> certFetcher)
   : m_policy(std::move(policy))
   , m_certFetcher(std::move(certFetcher))
@@ -71,12 +84,68 @@ Validator::getMaxDepth() const
   return m_maxDepth;
 }
 
+void
+Validator::setVerificationThreads(boost::asio::io_service& ioService, size_t nThreads)
+{
+  m_verificationPool.reset();
+  if (nThreads > 0) {
+    m_verificationPool = make_unique<detail::VerificationPool>(ioService, nThreads);
+  }
+}
+
+size_t
+Validator::getVerificationThreads() const
+{
+  return m_verificationPool == nullptr ? 0 : m_verificationPool->getNThreads();
+}
+
+void
+Validator::setValidationResultCacheCapacity(size_t capacity)
+{
+  m_resultCache.reset();
+  if (capacity > 0) {
+    m_resultCache = make_unique<detail::ValidationResultCache>(capacity);
+  }
+}
+
+size_t
+Validator::getValidationResultCacheCapacity() const
+{
+  return m_resultCache == nullptr ? 0 : m_resultCache->getCapacity();
+}
+
 void
 Validator::validate(const Data& data,
                     const DataValidationSuccessCallback& successCb,
                     const DataValidationFailureCallback& failureCb)
 {
-  auto state = make_shared<DataValidationState>(data, successCb, failureCb);
+  shared_ptr<DataValidationState> state;
+  if (m_resultCache == nullptr) {
+    state = make_shared<DataValidationState>(data, successCb, failureCb);
+  }
+  else {
+    auto anchorsVersion = getTrustAnchors().getVersion();
+    if (m_resultCache->find(data.getFullName(), anchorsVersion)) {
+      NDN_LOG_DEBUG("Data " << data.getName() << " has already been validated");
+      successCb(data);
+      return;
+    }
+
+    // the state is only reachable from its own success callback through a weak pointer
+    auto weakState = make_shared<weak_ptr<ValidationState>>();
+    state = make_shared<DataValidationState>(data,
+      [this, successCb, weakState, anchorsVersion] (const Data& data) {
+        auto state = weakState->lock();
+        if (state != nullptr && state->m_chainExpiry && m_resultCache != nullptr &&
+            getTrustAnchors().getVersion() == anchorsVersion) {
+          m_resultCache->insert(data.getFullName(), *state->m_chainExpiry, anchorsVersion);
+        }
+        successCb(data);
+      },
+      failureCb);
+    *weakState = state;
+  }
+  state->m_publicKeyCache = &m_publicKeyCache;
   NDN_LOG_DEBUG_DEPTH("Start validating data " << data.getName());
 
   m_policy->checkPolicy(data, state,
@@ -97,6 +166,7 @@ Validator::validate(const Interest& interest,
                     const InterestValidationFailureCallback& failureCb)
 {
   auto state = make_shared<InterestValidationState>(interest, successCb, failureCb);
+  state->m_publicKeyCache = &m_publicKeyCache;
 
   auto fmt = interest.getSignatureInfo() ? SignedInterestFormat::V03 : SignedInterestFormat::V02;
   state->setTag(make_shared<SignedInterestFormatTag>(fmt));
@@ -167,9 +237,32 @@ Validator::requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
   if (cert != nullptr) {
     NDN_LOG_TRACE_DEPTH("Found trusted certificate " << cert->getName());
 
+    optional<time::system_clock::TimePoint> chainExpiry;
+    if (m_resultCache != nullptr) {
+      chainExpiry = getNotAfter(*cert);
+      // a certificate from the verified cache stands for the chain that verified it, whose
+      // certificates are not known anymore; the result must not outlive the cached certificate
+      auto removalTime = getVerifiedCertCache().getRemovalTime(cert->getName());
+      if (chainExpiry && removalTime) {
+        chainExpiry = std::min(*chainExpiry, *removalTime);
+      }
+    }
     cert = state->verifyCertificateChain(*cert);
     if (cert != nullptr) {
-      state->verifyOriginalPacket(*cert);
+      for (const auto& chainCert : state->m_certificateChain) {
+        if (!chainExpiry) {
+          break;
+        }
+        auto notAfter = getNotAfter(chainCert);
+        if (notAfter && *notAfter < *chainExpiry) {
+          chainExpiry = notAfter;
+        }
+        else if (!notAfter) {
+          chainExpiry = nullopt;
+        }
+      }
+      state->m_chainExpiry = chainExpiry;
+      verifyOriginalPacket(state, *cert);
     }
     for (auto trustedCert = std::make_move_iterator(state->m_certificateChain.begin());
          trustedCert != std::make_move_iterator(state->m_certificateChain.end());
@@ -184,6 +277,25 @@ Validator::requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
     });
 }
 
+void
+Validator::verifyOriginalPacket(const shared_ptr<ValidationState>& state, const Certificate& trustedCert)
+{
+  if (m_verificationPool == nullptr) {
+    state->verifyOriginalPacket(trustedCert);
+    return;
+  }
+
+  // the key is parsed (or looked up) here, as the cache is not shared with the workers
+  auto key = m_publicKeyCache.find(trustedCert);
+  if (key == nullptr) {
+    state->finishOriginalPacket(false);
+    return;
+  }
+
+  m_verificationPool->submit([state, key] { return state->verifyOriginalSignature(*key); },
+                             [state] (bool isSignatureValid) { state->finishOriginalPacket(isSignatureValid); });
+}
+
 ////////////////////////////////////////////////////////////////////////
 // Trust anchor management
 ////////////////////////////////////////////////////////////////////////
@@ -219,6 +331,9 @@ void
 Validator::resetVerifiedCertificates()
 {
   CertificateStorage::resetVerifiedCerts();
+  if (m_resultCache != nullptr) {
+    m_resultCache->clear();
+  }
 }
 
 } // inline namespace v2
@@ -28,12 +28,19 @@
 #include "ndn-cxx/security/validation-callback.hpp"
 #include "ndn-cxx/security/validation-policy.hpp"
 #include "ndn-cxx/security/validation-state.hpp"
+#include "ndn-cxx/detail/asio-fwd.hpp"
 
 namespace ndn {
 
 class Face;
 
 namespace security {
+
+namespace detail {
+class ValidationResultCache;
+class VerificationPool;
+} // namespace detail
+
 inline namespace v2 {
 
 /**
@@ -109,6 +116,48 @@ public:
            const InterestValidationSuccessCallback& successCb,
            const InterestValidationFailureCallback& failureCb);
 
+  /**
+   * @brief Verify signatures of original packets on @p nThreads worker threads
+   *
+   * Certificate chains are still built and verified on the thread running @p ioService, which
+   * must be the thread that calls validate().  Once the chain of a packet is trusted, the final
+   * signature verification is queued to the workers, which process it in batches, and the
+   * success or failure callback is invoked on the @p ioService thread.  Callbacks of queued
+   * packets are invoked in the order in which their chains were completed.
+   *
+   * @param ioService io_service on which callbacks are invoked; must outlive the validator
+   * @param nThreads number of worker threads; 0 (the default) verifies synchronously
+   */
+  void
+  setVerificationThreads(boost::asio::io_service& ioService, size_t nThreads);
+
+  /**
+   * @return Number of verification worker threads, 0 if verification is synchronous
+   */
+  size_t
+  getVerificationThreads() const;
+
+  /**
+   * @brief Remember up to @p capacity Data packets that passed validation
+   *
+   * A Data packet with the same full name as a remembered one passes validation again
+   * immediately, without checking the policy or fetching and verifying any certificate.  An
+   * entry is valid until the earliest expiration of the certificates that verified the packet,
+   * and all entries are dropped when trust anchors are added or removed, or when
+   * resetVerifiedCertificates() is called.  Packets that were not verified with a certificate
+   * chain, e.g., signed with DigestSha256 or accepted by a bypassing policy, are not remembered.
+   *
+   * @param capacity maximum number of remembered packets; 0 (the default) disables the cache
+   */
+  void
+  setValidationResultCacheCapacity(size_t capacity);
+
+  /**
+   * @return Maximum number of remembered validated Data packets, 0 if the cache is disabled
+   */
+  size_t
+  getValidationResultCacheCapacity() const;
+
 public: // anchor management
   /**
    * @brief load static trust anchor.
@@ -176,10 +225,19 @@ private: // Common validator operations
   requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
                      const shared_ptr<ValidationState>& state);
 
+  /**
+   * @brief Verify the original packet of @p state using @p trustedCert, either synchronously
+   *        or on the verification worker threads
+   */
+  void
+  verifyOriginalPacket(const shared_ptr<ValidationState>& state, const Certificate& trustedCert);
+
 private:
   unique_ptr<ValidationPolicy> m_policy;
   unique_ptr<CertificateFetcher> m_certFetcher;
   size_t m_maxDepth;
+  unique_ptr<detail::VerificationPool> m_verificationPool;
+  unique_ptr<detail::ValidationResultCache> m_resultCache;
 };
 
 } // inline namespace v2
@@ -34,6 +34,7 @@
 #include "ndn-cxx/security/transform/public-key.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/security/transform/verifier-filter.hpp"
+#include "ndn-cxx/util/sha256.hpp"
 
 namespace ndn {
 namespace security {
@@ -160,6 +161,13 @@ verifyDigest(const ParseResult& params, DigestAlgorithm algorithm)
     return false;
   }
 
+  if (algorithm == DigestAlgorithm::SHA256) {
+    util::Sha256::Digest digest;
+    util::Sha256::computeDigest(params.bufs, digest);
+    return digest.size() == params.sig.size() &&
+           CRYPTO_memcmp(digest.data(), params.sig.data(), digest.size()) == 0;
+  }
+
   OBufferStream os;
   try {
     using namespace transform;
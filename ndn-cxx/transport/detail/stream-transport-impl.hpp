@@ -27,8 +27,10 @@
 #include <boost/asio/steady_timer.hpp>
 #include <boost/asio/write.hpp>
 
-#include <list>
-#include <queue>
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <vector>
 
 namespace ndn {
 namespace detail {
@@ -43,7 +45,17 @@ class StreamTransportImpl : public std::enable_shared_from_this<StreamTransportI
 {
 public:
   using Impl = StreamTransportImpl<BaseTransport, Protocol>;
-  using TransmissionQueue = std::queue<Block, std::list<Block>>;
+  using TransmissionQueue = std::deque<Block>;
+
+  /** \brief Maximum number of queued blocks coalesced into a single gather write.
+   *
+   *  This matches the number of buffers that Boost.Asio hands to a single `writev` call.
+   */
+  static constexpr size_t MAX_BLOCKS_PER_WRITE = 64;
+
+  /** \brief Size of the input buffer chunks allocated in zero-copy receive mode.
+   */
+  static constexpr size_t RECEIVE_CHUNK_SIZE = 8 * MAX_NDN_PACKET_SIZE;
 
   StreamTransportImpl(BaseTransport& transport, boost::asio::io_service& ioService)
     : m_transport(transport)
@@ -86,6 +98,7 @@ public:
     m_transport.m_isConnected = false;
     m_transport.m_isReceiving = false;
     TransmissionQueue{}.swap(m_transmissionQueue); // clear the queue
+    m_nBlocksInFlight = 0;
   }
 
   void
@@ -108,7 +121,9 @@ public:
 
     if (!m_transport.m_isReceiving) {
       m_transport.m_isReceiving = true;
-      m_inputBufferSize = 0;
+      // discard any partially received packet; the bytes are not reused in place,
+      // because Blocks received in zero-copy mode may still be referencing the input buffer
+      m_inputBufferStart = m_inputBufferSize;
       asyncReceive();
     }
   }
@@ -116,13 +131,14 @@ public:
   void
   send(const Block& block)
   {
-    m_transmissionQueue.push(block);
+    m_transmissionQueue.push_back(block);
 
-    if (m_transport.m_isConnected && m_transmissionQueue.size() == 1) {
+    if (m_transport.m_isConnected && m_nBlocksInFlight == 0) {
       asyncWrite();
     }
-    // if not connected or there's another transmission in progress (m_transmissionQueue.size() > 1),
-    // the next write will be scheduled either in connectHandler or in asyncWriteHandler
+    // if not connected or there's another transmission in progress (m_nBlocksInFlight > 0),
+    // the next write will be scheduled either in connectHandler or in asyncWriteHandler,
+    // and will include all blocks that have been queued in the meantime
   }
 
 protected:
@@ -160,7 +176,16 @@ protected:
   asyncWrite()
   {
     BOOST_ASSERT(!m_transmissionQueue.empty());
-    boost::asio::async_write(m_socket, boost::asio::buffer(m_transmissionQueue.front()),
+    BOOST_ASSERT(m_nBlocksInFlight == 0);
+
+    // coalesce the blocks at the head of the queue into a single scatter/gather write;
+    // they stay in the queue (and thus alive) until the write completes
+    m_nBlocksInFlight = std::min(m_transmissionQueue.size(), MAX_BLOCKS_PER_WRITE);
+    std::vector<boost::asio::const_buffer> buffers;
+    buffers.reserve(m_nBlocksInFlight);
+    std::copy_n(m_transmissionQueue.begin(), m_nBlocksInFlight, std::back_inserter(buffers));
+
+    boost::asio::async_write(m_socket, buffers,
       // capture a copy of the shared_ptr to "this" to prevent deallocation
       [this, self = this->shared_from_this()] (const auto& error, size_t) {
         if (error) {
@@ -176,8 +201,15 @@ protected:
           return; // queue has been already cleared
         }
 
-        BOOST_ASSERT(!m_transmissionQueue.empty());
-        m_transmissionQueue.pop();
+        BOOST_ASSERT(m_transmissionQueue.size() >= m_nBlocksInFlight);
+        auto& counters = m_transport.m_counters;
+        counters.nOutPackets += m_nBlocksInFlight;
+        ++counters.nOutWrites;
+        counters.maxPacketsPerWrite = std::max<uint64_t>(counters.maxPacketsPerWrite, m_nBlocksInFlight);
+
+        m_transmissionQueue.erase(m_transmissionQueue.begin(),
+                                  m_transmissionQueue.begin() + m_nBlocksInFlight);
+        m_nBlocksInFlight = 0;
 
         if (!m_transmissionQueue.empty()) {
           asyncWrite();
@@ -188,8 +220,10 @@ protected:
   void
   asyncReceive()
   {
-    m_socket.async_receive(boost::asio::buffer(m_inputBuffer + m_inputBufferSize,
-                                               MAX_NDN_PACKET_SIZE - m_inputBufferSize), 0,
+    prepareInputBuffer();
+
+    m_socket.async_receive(boost::asio::buffer(m_inputBuffer->data() + m_inputBufferSize,
+                                               m_inputBuffer->size() - m_inputBufferSize), 0,
       // capture a copy of the shared_ptr to "this" to prevent deallocation
       [this, self = this->shared_from_this()] (const auto& error, size_t nBytesRecvd) {
         if (error) {
@@ -204,54 +238,103 @@ protected:
         m_inputBufferSize += nBytesRecvd;
         // do magic
 
-        std::size_t offset = 0;
-        bool hasProcessedSome = processAllReceived(m_inputBuffer, offset, m_inputBufferSize);
-        if (!hasProcessedSome && m_inputBufferSize == MAX_NDN_PACKET_SIZE && offset == 0) {
+        processAllReceived();
+        if (m_inputBufferSize - m_inputBufferStart >= MAX_NDN_PACKET_SIZE) {
           m_transport.close();
           NDN_THROW(Transport::Error("input buffer full, but a valid TLV cannot be decoded"));
         }
 
-        if (offset > 0) {
-          if (offset != m_inputBufferSize) {
-            std::copy(m_inputBuffer + offset, m_inputBuffer + m_inputBufferSize, m_inputBuffer);
-            m_inputBufferSize -= offset;
-          }
-          else {
-            m_inputBufferSize = 0;
-          }
-        }
-
         asyncReceive();
       });
   }
 
-  bool
-  processAllReceived(uint8_t* buffer, size_t& offset, size_t nBytesAvailable)
+  /** \brief Ensure the input buffer can accommodate a complete packet after the unprocessed bytes.
+   *
+   *  Unprocessed bytes are moved to the beginning of the input buffer, or into a new chunk if the
+   *  current one is still referenced by Blocks handed out in zero-copy receive mode.
+   */
+  void
+  prepareInputBuffer()
   {
-    while (offset < nBytesAvailable) {
-      bool isOk = false;
-      Block element;
-      std::tie(isOk, element) = Block::fromBuffer({buffer + offset, nBytesAvailable - offset});
-      if (!isOk)
-        return false;
+    if (m_inputBuffer != nullptr && m_inputBuffer->size() - m_inputBufferStart >= MAX_NDN_PACKET_SIZE) {
+      return;
+    }
+
+    size_t chunkSize = m_transport.m_isZeroCopyReceive ? RECEIVE_CHUNK_SIZE : MAX_NDN_PACKET_SIZE;
+    if (m_inputBuffer == nullptr || m_inputBuffer.use_count() > 1 || m_inputBuffer->size() != chunkSize) {
+      auto chunk = std::make_shared<Buffer>(chunkSize);
+      if (m_inputBuffer != nullptr) {
+        std::copy(m_inputBuffer->begin() + m_inputBufferStart, m_inputBuffer->begin() + m_inputBufferSize,
+                  chunk->begin());
+      }
+      m_inputBuffer = std::move(chunk);
+    }
+    else {
+      std::copy(m_inputBuffer->begin() + m_inputBufferStart, m_inputBuffer->begin() + m_inputBufferSize,
+                m_inputBuffer->begin());
+    }
+    m_inputBufferSize -= m_inputBufferStart;
+    m_inputBufferStart = 0;
+  }
 
+  void
+  processAllReceived()
+  {
+    while (m_inputBufferStart < m_inputBufferSize) {
+      Block element;
+      if (m_transport.m_isZeroCopyReceive) {
+        // share the input buffer instead of copying the TLV element
+        auto begin = m_inputBuffer->cbegin() + m_inputBufferStart;
+        auto pos = begin;
+        const auto end = m_inputBuffer->cbegin() + m_inputBufferSize;
+
+        uint32_t type = 0;
+        uint64_t length = 0;
+        if (!tlv::readType(pos, end, type) || !tlv::readVarNumber(pos, end, length)) {
+          return;
+        }
+        // enforce the same limit as Block::fromBuffer, although the chunk could hold a larger TLV
+        if (length > MAX_NDN_PACKET_SIZE - static_cast<size_t>(std::distance(begin, pos))) {
+          m_transport.close();
+          NDN_THROW(Transport::Error("input buffer full, but a valid TLV cannot be decoded"));
+        }
+        if (length > static_cast<uint64_t>(std::distance(pos, end))) {
+          return;
+        }
+        element = Block(m_inputBuffer, type, begin, pos + length, pos, pos + length);
+      }
+      else {
+        bool isOk = false;
+        std::tie(isOk, element) = Block::fromBuffer({m_inputBuffer->data() + m_inputBufferStart,
+                                                     m_inputBufferSize - m_inputBufferStart});
+        if (!isOk)
+          return;
+      }
+
+      m_inputBufferStart += element.size();
       m_transport.m_receiveCallback(element);
-      offset += element.size();
     }
-    return true;
   }
 
 protected:
   BaseTransport& m_transport;
 
   typename Protocol::socket m_socket;
-  uint8_t m_inputBuffer[MAX_NDN_PACKET_SIZE];
-  size_t m_inputBufferSize = 0;
+  shared_ptr<Buffer> m_inputBuffer;
+  size_t m_inputBufferStart = 0; ///< offset of the first unprocessed byte in m_inputBuffer
+  size_t m_inputBufferSize = 0; ///< number of bytes received into m_inputBuffer
   TransmissionQueue m_transmissionQueue;
+  size_t m_nBlocksInFlight = 0; ///< number of blocks at the head of the queue being written
   boost::asio::steady_timer m_connectTimer;
   bool m_isConnecting = false;
 };
 
+template<typename BaseTransport, typename Protocol>
+constexpr size_t StreamTransportImpl<BaseTransport, Protocol>::MAX_BLOCKS_PER_WRITE;
+
+template<typename BaseTransport, typename Protocol>
+constexpr size_t StreamTransportImpl<BaseTransport, Protocol>::RECEIVE_CHUNK_SIZE;
+
 } // namespace detail
 } // namespace ndn
 
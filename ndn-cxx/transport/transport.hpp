@@ -43,6 +43,18 @@ public:
     Error(const boost::system::error_code& code, const std::string& msg);
   };
 
+  /** \brief Transmission statistics of a transport.
+   */
+  struct Counters
+  {
+    /// number of TLV blocks written to the underlying socket
+    uint64_t nOutPackets = 0;
+    /// number of write operations issued; each may coalesce several blocks
+    uint64_t nOutWrites = 0;
+    /// largest number of blocks coalesced into a single write operation
+    uint64_t maxPacketsPerWrite = 0;
+  };
+
   using ReceiveCallback = std::function<void(const Block& wire)>;
   using ErrorCallback = std::function<void()>;
 
@@ -107,11 +119,49 @@ public:
     return m_isReceiving;
   }
 
+  /**
+   * \brief Return whether zero-copy receive mode is enabled.
+   */
+  bool
+  isZeroCopyReceive() const noexcept
+  {
+    return m_isZeroCopyReceive;
+  }
+
+  /**
+   * \brief Enable or disable zero-copy receive mode.
+   *
+   * By default, each TLV block passed to the receive callback is copied into its own buffer.
+   * In zero-copy mode, incoming bytes are read into larger ref-counted chunks, and received
+   * blocks share the chunk instead, saving one allocation and one copy per packet. However,
+   * a block retained by the application keeps its whole chunk alive.
+   */
+  void
+  setZeroCopyReceive(bool wantZeroCopy) noexcept
+  {
+    m_isZeroCopyReceive = wantZeroCopy;
+  }
+
+  /**
+   * \brief Return the transmission statistics of the transport.
+   *
+   * Blocks passed to send() while a previous write is still in progress are queued and then
+   * transmitted together in a single scatter/gather write; the ratio between
+   * Counters::nOutPackets and Counters::nOutWrites indicates how effective this batching is.
+   */
+  const Counters&
+  getCounters() const noexcept
+  {
+    return m_counters;
+  }
+
 protected:
   boost::asio::io_service* m_ioService = nullptr;
   ReceiveCallback m_receiveCallback;
   bool m_isConnected = false;
   bool m_isReceiving = false;
+  bool m_isZeroCopyReceive = false;
+  Counters m_counters;
 };
 
 } // namespace ndn
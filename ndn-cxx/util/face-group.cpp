@@ -0,0 +1,189 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/face-group.hpp"
+
+#include <boost/asio/io_service.hpp>
+
+#include <atomic>
+#include <thread>
+
+namespace ndn {
+namespace util {
+
+class FaceGroup::Shard : noncopyable
+{
+public:
+  Shard(const FaceFactory& makeFace, size_t submissionQueueCapacity)
+    : face(makeFace ? makeFace(io) : make_unique<Face>(nullptr, io))
+  {
+    face->enableSubmissionQueue(submissionQueueCapacity);
+  }
+
+public:
+  boost::asio::io_service io;
+  unique_ptr<Face> face;
+  unique_ptr<boost::asio::io_service::work> work;
+  std::thread thread;
+
+  std::atomic<uint64_t> nOutInterests{0};
+  std::atomic<uint64_t> nInData{0};
+  std::atomic<uint64_t> nInNacks{0};
+  std::atomic<uint64_t> nTimeouts{0};
+};
+
+FaceGroup::FaceGroup(size_t nShards, const FaceFactory& makeFace, size_t submissionQueueCapacity)
+{
+  if (nShards == 0) {
+    nShards = std::max(std::thread::hardware_concurrency(), 1U);
+  }
+
+  m_shards.reserve(nShards);
+  for (size_t i = 0; i < nShards; ++i) {
+    m_shards.push_back(make_unique<Shard>(makeFace, submissionQueueCapacity));
+  }
+}
+
+FaceGroup::~FaceGroup()
+{
+  stop();
+}
+
+size_t
+FaceGroup::getShardIndex(const Name& name) const
+{
+  return name.getHash() % m_shards.size();
+}
+
+Face&
+FaceGroup::getFace(size_t shard)
+{
+  return *m_shards.at(shard)->face;
+}
+
+boost::asio::io_service&
+FaceGroup::getIoService(size_t shard)
+{
+  return m_shards.at(shard)->io;
+}
+
+void
+FaceGroup::start()
+{
+  for (auto& shard : m_shards) {
+    BOOST_ASSERT(!shard->thread.joinable());
+    shard->io.reset(); // allow run() after a previous stop()
+    shard->work = make_unique<boost::asio::io_service::work>(shard->io);
+    shard->thread = std::thread([&io = shard->io] { io.run(); });
+  }
+}
+
+void
+FaceGroup::stop()
+{
+  for (auto& shard : m_shards) {
+    if (!shard->thread.joinable()) {
+      continue;
+    }
+    shard->face->shutdown();
+    shard->io.post([&io = shard->io] { io.stop(); });
+    shard->work.reset();
+  }
+
+  for (auto& shard : m_shards) {
+    if (shard->thread.joinable()) {
+      shard->thread.join();
+    }
+  }
+}
+
+bool
+FaceGroup::expressInterest(const Interest& interest,
+                           const DataCallback& afterSatisfied,
+                           const NackCallback& afterNacked,
+                           const TimeoutCallback& afterTimeout)
+{
+  Shard& shard = *m_shards[getShardIndex(interest.getName())];
+  bool isQueued = shard.face->submitInterest(interest,
+    [&shard, afterSatisfied] (const Interest& i, const Data& d) {
+      ++shard.nInData;
+      if (afterSatisfied) {
+        afterSatisfied(i, d);
+      }
+    },
+    [&shard, afterNacked] (const Interest& i, const lp::Nack& n) {
+      ++shard.nInNacks;
+      if (afterNacked) {
+        afterNacked(i, n);
+      }
+    },
+    [&shard, afterTimeout] (const Interest& i) {
+      ++shard.nTimeouts;
+      if (afterTimeout) {
+        afterTimeout(i);
+      }
+    });
+
+  if (isQueued) {
+    ++shard.nOutInterests;
+  }
+  return isQueued;
+}
+
+void
+FaceGroup::post(size_t shard, std::function<void(Face&)> f)
+{
+  Face& face = *m_shards.at(shard)->face;
+  m_shards[shard]->io.post([&face, f = std::move(f)] { f(face); });
+}
+
+FaceGroup::Statistics
+FaceGroup::getStatistics(size_t shard) const
+{
+  const Shard& s = *m_shards.at(shard);
+  Statistics stats;
+  stats.nOutInterests = s.nOutInterests;
+  stats.nInData = s.nInData;
+  stats.nInNacks = s.nInNacks;
+  stats.nTimeouts = s.nTimeouts;
+  stats.nRejectedSubmissions = s.face->getNRejectedSubmissions();
+  stats.nQueuedSubmissions = s.face->getSubmissionQueueDepth();
+  return stats;
+}
+
+FaceGroup::Statistics
+FaceGroup::getStatistics() const
+{
+  Statistics total;
+  for (size_t i = 0; i < m_shards.size(); ++i) {
+    Statistics stats = getStatistics(i);
+    total.nOutInterests += stats.nOutInterests;
+    total.nInData += stats.nInData;
+    total.nInNacks += stats.nInNacks;
+    total.nTimeouts += stats.nTimeouts;
+    total.nRejectedSubmissions += stats.nRejectedSubmissions;
+    total.nQueuedSubmissions += stats.nQueuedSubmissions;
+  }
+  return total;
+}
+
+} // namespace util
+} // namespace ndn
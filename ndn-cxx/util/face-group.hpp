@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_FACE_GROUP_HPP
+#define NDN_CXX_UTIL_FACE_GROUP_HPP
+
+#include "ndn-cxx/face.hpp"
+
+namespace ndn {
+namespace util {
+
+/** \brief A group of Faces, each with its own io_service, transport connection, and thread.
+ *
+ *  A single Face processes its pending Interests, timers, and transport on one io_service
+ *  thread, which limits a consumer to one CPU core. FaceGroup spreads the work over several
+ *  shards. Each shard owns a Face connected to the forwarder through its own transport and
+ *  runs its io_service on a dedicated thread.
+ *
+ *  Interests are routed to a shard by the hash of their name. All callbacks of a shard,
+ *  including those of SegmentFetcher, Validator, and signals started on that shard via post(),
+ *  are invoked on the shard's thread. State belonging to one shard must not be accessed from
+ *  another shard without synchronization.
+ *
+ *  \code
+ *  util::FaceGroup group; // one shard per core
+ *  group.start();
+ *  Name prefix("/example/object/v=1");
+ *  group.post(group.getShardIndex(prefix), [=] (Face& face) {
+ *    // runs on the owning shard; the fetcher's signals are emitted on this shard too
+ *    auto fetcher = SegmentFetcher::start(face, Interest(prefix),
+ *                                         security::getAcceptAllValidator());
+ *    fetcher->onComplete.connect([] (ConstBufferPtr content) { ... });
+ *  });
+ *  \endcode
+ */
+class FaceGroup : noncopyable
+{
+public:
+  /** \brief A function that creates the Face of a shard, using the given io_service.
+   */
+  using FaceFactory = std::function<unique_ptr<Face>(boost::asio::io_service&)>;
+
+  /** \brief Counters of one shard, or of all shards combined.
+   */
+  struct Statistics
+  {
+    uint64_t nOutInterests = 0; ///< Interests expressed through expressInterest()
+    uint64_t nInData = 0;       ///< Interests satisfied by Data
+    uint64_t nInNacks = 0;      ///< Interests rejected by Nack
+    uint64_t nTimeouts = 0;     ///< Interests that timed out
+    uint64_t nRejectedSubmissions = 0; ///< submissions rejected because a queue was full
+    size_t nQueuedSubmissions = 0;     ///< submissions waiting for the shard thread
+  };
+
+  /** \brief Create a FaceGroup.
+   *  \param nShards number of shards; if zero, one shard per hardware thread is created
+   *  \param makeFace function that creates the Face of each shard; if empty, each shard
+   *                  uses a Face with the default transport and KeyChain
+   *  \param submissionQueueCapacity capacity of each shard's submission queue
+   *  \sa Face::enableSubmissionQueue
+   *
+   *  The shard threads are not started until start() is called.
+   */
+  explicit
+  FaceGroup(size_t nShards = 0, const FaceFactory& makeFace = nullptr,
+            size_t submissionQueueCapacity = 1024);
+
+  /** \brief Stop all shards and join their threads.
+   */
+  ~FaceGroup();
+
+  /** \brief Return the number of shards.
+   */
+  size_t
+  size() const
+  {
+    return m_shards.size();
+  }
+
+  /** \brief Return the shard that owns \p name.
+   *
+   *  To keep all Interests of a segmented object on one shard, pass the object's prefix
+   *  rather than the name of each segment.
+   */
+  size_t
+  getShardIndex(const Name& name) const;
+
+  /** \brief Return the Face of a shard.
+   *  \warning The Face is not thread-safe; use it only on the shard's thread, e.g. from post().
+   */
+  Face&
+  getFace(size_t shard);
+
+  /** \brief Return the io_service of a shard.
+   */
+  boost::asio::io_service&
+  getIoService(size_t shard);
+
+  /** \brief Start one thread per shard, running the shard's io_service.
+   *  \pre the shards are not running
+   */
+  void
+  start();
+
+  /** \brief Shut down every shard's Face and join the shard threads.
+   *
+   *  Pending Interests are canceled without invoking their callbacks.
+   */
+  void
+  stop();
+
+  /** \brief Express an Interest on the shard that owns its name.
+   *
+   *  This method can be called from any thread. The callbacks are invoked on the shard thread.
+   *  \return whether the Interest has been queued; false if the shard's queue is full
+   */
+  bool
+  expressInterest(const Interest& interest,
+                  const DataCallback& afterSatisfied,
+                  const NackCallback& afterNacked,
+                  const TimeoutCallback& afterTimeout);
+
+  /** \brief Invoke \p f with the shard's Face on the shard thread.
+   *
+   *  This method can be called from any thread. Objects that need a Face, such as
+   *  SegmentFetcher, should be created from within \p f so that all their callbacks and
+   *  signals are delivered on the owning shard.
+   */
+  void
+  post(size_t shard, std::function<void(Face&)> f);
+
+  /** \brief Return the counters of one shard.
+   *  \note This method can be called from any thread; the result is approximate.
+   */
+  Statistics
+  getStatistics(size_t shard) const;
+
+  /** \brief Return the counters of all shards combined.
+   *  \note This method can be called from any thread; the result is approximate.
+   */
+  Statistics
+  getStatistics() const;
+
+private:
+  class Shard;
+  std::vector<unique_ptr<Shard>> m_shards;
+};
+
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_CXX_UTIL_FACE_GROUP_HPP
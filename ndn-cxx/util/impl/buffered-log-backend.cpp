@@ -0,0 +1,348 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/impl/buffered-log-backend.hpp"
+
+#include <algorithm>
+#include <cinttypes> // for PRIdLEAST64
+#include <cstdio>    // for std::snprintf()
+#include <cstdlib>   // for std::abs()
+#include <cstring>   // for std::memcpy()
+#include <iomanip>
+#include <ostream>
+
+namespace ndn {
+namespace util {
+namespace detail {
+
+std::string
+formatLogTimestamp(const time::system_clock::TimePoint& timestamp)
+{
+  using namespace ndn::time;
+
+  const auto sinceEpoch = timestamp.time_since_epoch();
+  BOOST_ASSERT(sinceEpoch.count() >= 0);
+  // use abs() to silence truncation warning in snprintf(), see #4365
+  const auto usecs = std::abs(duration_cast<microseconds>(sinceEpoch).count());
+  const auto usecsPerSec = microseconds::period::den;
+
+  // 10 (whole seconds) + '.' + 6 (fraction) + '\0'
+  std::string buffer(10 + 1 + 6 + 1, '\0'); // note 1 extra byte still needed for snprintf
+  BOOST_ASSERT_MSG(usecs / usecsPerSec <= 9999999999, "whole seconds cannot fit in 10 characters");
+
+  static_assert(std::is_same<microseconds::rep, int_least64_t>::value,
+                "PRIdLEAST64 is incompatible with microseconds::rep");
+  std::snprintf(&buffer.front(), buffer.size(), "%" PRIdLEAST64 ".%06" PRIdLEAST64,
+                usecs / usecsPerSec, usecs % usecsPerSec);
+
+  // need to remove extra 1 byte ('\0')
+  buffer.pop_back();
+  return buffer;
+}
+
+/** \brief Lock-free single-producer single-consumer ring buffer of binary log records.
+ *
+ *  Each record is a RecordHeader followed by the module name and the message text, and may
+ *  wrap around the end of the storage.  The producer only advances m_head and the consumer
+ *  only advances m_tail.
+ */
+class BufferedLogBackend::RingBuffer : noncopyable
+{
+public:
+  /** \pre size is a power of 2
+   */
+  explicit
+  RingBuffer(size_t size)
+    : m_data(size)
+  {
+  }
+
+  /** \brief Append a record; called on the producer thread only.
+   *  \param[out] wasEmpty whether the consumer had read all preceding records when the new
+   *                       record was published, i.e., whether it may need to be woken up
+   *  \return false if there is not enough free space
+   */
+  bool
+  write(LogLevel level, const std::string& moduleName, const char* message, size_t messageLength,
+        bool& wasEmpty)
+  {
+    RecordHeader header{time::duration_cast<time::microseconds>(
+                          time::system_clock::now().time_since_epoch()).count(),
+                        level, moduleName.size(), messageLength};
+    size_t recordSize = sizeof(header) + header.moduleLength + header.messageLength;
+
+    size_t head = m_head.load(std::memory_order_relaxed);
+    size_t tail = m_tail.load(std::memory_order_acquire);
+    if (recordSize > m_data.size() - (head - tail)) {
+      return false;
+    }
+
+    copyIn(head, &header, sizeof(header));
+    copyIn(head + sizeof(header), moduleName.data(), header.moduleLength);
+    copyIn(head + sizeof(header) + header.moduleLength, message, header.messageLength);
+    // sequentially consistent, so that either this thread sees that the consumer has read
+    // everything before the new record, or the consumer sees the new record before it sleeps
+    m_head.store(head + recordSize);
+    wasEmpty = m_tail.load() == head;
+    return true;
+  }
+
+  /** \brief Remove all available records, appending them to \p records;
+   *         called on the consumer thread only.
+   */
+  void
+  read(std::vector<Record>& records)
+  {
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    size_t head = m_head.load(std::memory_order_acquire);
+
+    while (tail != head) {
+      RecordHeader header;
+      copyOut(tail, &header, sizeof(header));
+      tail += sizeof(header);
+
+      Record record{header.usecs, header.level,
+                    std::string(header.moduleLength, '\0'), std::string(header.messageLength, '\0')};
+      copyOut(tail, &record.moduleName[0], header.moduleLength);
+      tail += header.moduleLength;
+      copyOut(tail, &record.message[0], header.messageLength);
+      tail += header.messageLength;
+
+      records.push_back(std::move(record));
+    }
+
+    m_tail.store(tail);
+  }
+
+  bool
+  isEmpty() const
+  {
+    return m_tail.load() == m_head.load();
+  }
+
+private:
+  struct RecordHeader
+  {
+    int64_t usecs;
+    LogLevel level;
+    size_t moduleLength;
+    size_t messageLength;
+  };
+
+  void
+  copyIn(size_t pos, const void* src, size_t len)
+  {
+    size_t offset = pos & (m_data.size() - 1);
+    size_t first = std::min(len, m_data.size() - offset);
+    std::memcpy(&m_data[offset], src, first);
+    std::memcpy(&m_data[0], static_cast<const char*>(src) + first, len - first);
+  }
+
+  void
+  copyOut(size_t pos, void* dst, size_t len) const
+  {
+    size_t offset = pos & (m_data.size() - 1);
+    size_t first = std::min(len, m_data.size() - offset);
+    std::memcpy(dst, &m_data[offset], first);
+    std::memcpy(static_cast<char*>(dst) + first, &m_data[0], len - first);
+  }
+
+private:
+  std::vector<char> m_data;
+  std::atomic<size_t> m_head{0}; ///< total bytes written, modified by the producer
+  std::atomic<size_t> m_tail{0}; ///< total bytes read, modified by the consumer
+};
+
+static uint64_t
+makeBackendId()
+{
+  static std::atomic<uint64_t> lastId{0};
+  return ++lastId;
+}
+
+static size_t
+roundUpToPowerOf2(size_t n)
+{
+  size_t size = 1;
+  while (size < n) {
+    size <<= 1;
+  }
+  return size;
+}
+
+BufferedLogBackend::BufferedLogBackend(size_t bufferSize)
+  : m_id(makeBackendId())
+  , m_bufferSize(roundUpToPowerOf2(bufferSize))
+  , m_thread(&BufferedLogBackend::run, this)
+{
+}
+
+BufferedLogBackend::~BufferedLogBackend()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isStopping = true;
+  }
+  m_cv.notify_all();
+  m_thread.join();
+
+  flush();
+}
+
+void
+BufferedLogBackend::setOutput(shared_ptr<std::ostream> os)
+{
+  std::lock_guard<std::mutex> lock(m_outputMutex);
+  drain();
+  m_os = std::move(os);
+}
+
+void
+BufferedLogBackend::submit(LogLevel level, const std::string& moduleName,
+                           const char* message, size_t messageLength)
+{
+  bool wasEmpty = false;
+  if (!getThreadBuffer().write(level, moduleName, message, messageLength, wasEmpty)) {
+    m_nDropped.fetch_add(1, std::memory_order_relaxed);
+  }
+  else if (wasEmpty && m_isSleeping.load()) {
+    // the background thread sets m_isSleeping while holding the mutex, before its last check
+    // of the ring buffers; holding the mutex here ensures that the notification cannot be
+    // missed between that check and the beginning of its wait
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cv.notify_one();
+  }
+}
+
+void
+BufferedLogBackend::flush()
+{
+  std::lock_guard<std::mutex> lock(m_outputMutex);
+  drain();
+  if (m_os != nullptr) {
+    m_os->flush();
+  }
+}
+
+BufferedLogBackend::RingBuffer&
+BufferedLogBackend::getThreadBuffer()
+{
+  struct ThreadBuffer
+  {
+    uint64_t backendId = 0;
+    shared_ptr<RingBuffer> buffer;
+  };
+  thread_local ThreadBuffer threadBuffer;
+
+  if (threadBuffer.backendId != m_id) {
+    threadBuffer.buffer = make_shared<RingBuffer>(m_bufferSize);
+    threadBuffer.backendId = m_id;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_buffers.push_back(threadBuffer.buffer);
+  }
+  return *threadBuffer.buffer;
+}
+
+void
+BufferedLogBackend::run()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_isStopping) {
+    lock.unlock();
+    bool hasRecords = false;
+    {
+      std::lock_guard<std::mutex> outputLock(m_outputMutex);
+      hasRecords = drain();
+      if (hasRecords && m_os != nullptr) {
+        m_os->flush();
+      }
+    }
+    lock.lock();
+
+    if (!hasRecords) {
+      // sequentially consistent, so that either a producer that publishes a record into an
+      // empty ring buffer sees this flag, or hasPendingRecords() sees that record
+      m_isSleeping.store(true);
+      m_cv.wait(lock, [this] { return m_isStopping || hasPendingRecords(); });
+      m_isSleeping.store(false);
+    }
+  }
+}
+
+bool
+BufferedLogBackend::hasPendingRecords() const
+{
+  return std::any_of(m_buffers.begin(), m_buffers.end(),
+                     [] (const auto& buffer) { return !buffer->isEmpty(); });
+}
+
+bool
+BufferedLogBackend::drain()
+{
+  std::vector<shared_ptr<RingBuffer>> buffers;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    buffers = m_buffers;
+  }
+
+  m_records.clear();
+  for (const auto& buffer : buffers) {
+    buffer->read(m_records);
+  }
+  buffers.clear();
+
+  {
+    // a buffer referenced only from m_buffers belongs to a thread that has exited
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_buffers.erase(std::remove_if(m_buffers.begin(), m_buffers.end(),
+                                   [] (const auto& buffer) {
+                                     return buffer.use_count() == 1 && buffer->isEmpty();
+                                   }),
+                    m_buffers.end());
+  }
+
+  uint64_t nDropped = getNDropped();
+  if (m_records.empty() && nDropped == m_nReportedDropped) {
+    return false;
+  }
+
+  // records of different threads are only ordered by their timestamps
+  std::stable_sort(m_records.begin(), m_records.end(),
+                   [] (const Record& a, const Record& b) { return a.usecs < b.usecs; });
+
+  if (m_os != nullptr) {
+    for (const auto& record : m_records) {
+      *m_os << formatLogTimestamp(time::system_clock::TimePoint(time::microseconds(record.usecs)))
+            << " " << std::setw(5) << record.level << ": "
+            << "[" << record.moduleName << "] " << record.message << "\n";
+    }
+    if (nDropped != m_nReportedDropped) {
+      *m_os << "(" << nDropped - m_nReportedDropped << " log messages were dropped)\n";
+    }
+  }
+  m_nReportedDropped = nDropped;
+  m_records.clear();
+  return true;
+}
+
+} // namespace detail
+} // namespace util
+} // namespace ndn
@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_IMPL_BUFFERED_LOG_BACKEND_HPP
+#define NDN_CXX_UTIL_IMPL_BUFFERED_LOG_BACKEND_HPP
+
+#include "ndn-cxx/util/logger.hpp"
+#include "ndn-cxx/util/time.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ndn {
+namespace util {
+namespace detail {
+
+/** \brief Format \p timestamp as seconds since the epoch with microsecond precision.
+ */
+std::string
+formatLogTimestamp(const time::system_clock::TimePoint& timestamp);
+
+/** \brief Logging backend that defers the output of log records to a background thread.
+ *
+ *  Every thread that logs owns a lock-free single-producer single-consumer ring buffer.
+ *  submit() copies a binary record (timestamp, severity, module name, message text) into the
+ *  ring buffer of the calling thread and never blocks; if the buffer is full, the record is
+ *  dropped and counted.  The background thread collects the records of all threads, formats
+ *  them, and writes them to the output stream.  The records collected in one pass are sorted
+ *  by timestamp, so the output is only approximately ordered across passes.
+ *
+ *  The background thread sleeps while all ring buffers are empty, and is woken up by the
+ *  first record written into an empty ring buffer.  submit() only takes a lock to register
+ *  the ring buffer of a new thread, or to wake up the background thread while it sleeps.
+ */
+class BufferedLogBackend : noncopyable
+{
+public:
+  static constexpr size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+  /** \param bufferSize size of the ring buffer of each thread in bytes, rounded up to a power of 2
+   */
+  explicit
+  BufferedLogBackend(size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+  /** \brief Write out the remaining records and stop the background thread.
+   */
+  ~BufferedLogBackend();
+
+  /** \brief Set or replace the output stream; nullptr discards the records.
+   */
+  void
+  setOutput(shared_ptr<std::ostream> os);
+
+  /** \brief Append a record to the ring buffer of the calling thread.
+   */
+  void
+  submit(LogLevel level, const std::string& moduleName, const char* message, size_t messageLength);
+
+  /** \brief Write out all records submitted so far, and flush the output stream.
+   */
+  void
+  flush();
+
+  /** \brief Number of records dropped because the ring buffer of their thread was full.
+   */
+  uint64_t
+  getNDropped() const
+  {
+    return m_nDropped.load(std::memory_order_relaxed);
+  }
+
+private:
+  class RingBuffer;
+
+  struct Record
+  {
+    int64_t usecs;
+    LogLevel level;
+    std::string moduleName;
+    std::string message;
+  };
+
+  RingBuffer&
+  getThreadBuffer();
+
+  void
+  run();
+
+  /** \pre m_mutex is held
+   */
+  bool
+  hasPendingRecords() const;
+
+  /** \brief Move records from all ring buffers to the output stream.
+   *  \return whether any record was found
+   *  \pre m_outputMutex is held
+   */
+  bool
+  drain();
+
+private:
+  const uint64_t m_id;
+  const size_t m_bufferSize;
+
+  std::mutex m_mutex; ///< protects m_buffers and m_isStopping
+  std::vector<shared_ptr<RingBuffer>> m_buffers;
+  bool m_isStopping = false;
+  std::condition_variable m_cv;
+  std::atomic<bool> m_isSleeping{false}; ///< whether the background thread waits on m_cv
+
+  std::mutex m_outputMutex; ///< protects the consumer side of the ring buffers and the fields below
+  shared_ptr<std::ostream> m_os;
+  std::vector<Record> m_records;
+  uint64_t m_nReportedDropped = 0;
+
+  std::atomic<uint64_t> m_nDropped{0};
+  std::thread m_thread;
+};
+
+} // namespace detail
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_CXX_UTIL_IMPL_BUFFERED_LOG_BACKEND_HPP
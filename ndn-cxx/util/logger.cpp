@@ -21,6 +21,7 @@
 
 #include "ndn-cxx/util/logger.hpp"
 #include "ndn-cxx/util/logging.hpp"
+#include "ndn-cxx/util/impl/buffered-log-backend.hpp"
 
 #include <cstring> // for std::strspn()
 
@@ -117,5 +118,92 @@ Logger::registerModuleName(const char* name)
   Logging::get().registerLoggerNameImpl(std::move(moduleName));
 }
 
+namespace detail {
+
+/** \brief Stream buffer that appends to a string.
+ */
+class MessageBuffer : public std::streambuf
+{
+public:
+  std::string message;
+
+private:
+  int_type
+  overflow(int_type ch) final
+  {
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+      message.push_back(traits_type::to_char_type(ch));
+    }
+    return ch;
+  }
+
+  std::streamsize
+  xsputn(const char* s, std::streamsize n) final
+  {
+    message.append(s, static_cast<size_t>(n));
+    return n;
+  }
+};
+
+class BufferedLogRecord::Stream : noncopyable
+{
+public:
+  /** \brief Clear the message and restore the initial state of the stream.
+   */
+  void
+  reset()
+  {
+    buffer.message.clear();
+    os.clear();
+    os.flags(std::ios_base::skipws | std::ios_base::dec);
+    os.precision(6);
+    os.width(0);
+    os.fill(' ');
+  }
+
+public:
+  MessageBuffer buffer;
+  std::ostream os{&buffer};
+  bool isInUse = false;
+};
+
+BufferedLogRecord::BufferedLogRecord(BufferedLogBackend& backend, const Logger& logger, LogLevel level)
+  : m_backend(backend)
+  , m_logger(logger)
+  , m_level(level)
+{
+  // the buffer keeps its capacity, so that formatting a message does not allocate memory
+  thread_local Stream threadStream;
+
+  if (threadStream.isInUse) {
+    // a message is logged while formatting another one
+    m_nestedStream = make_unique<Stream>();
+    m_stream = m_nestedStream.get();
+  }
+  else {
+    threadStream.isInUse = true;
+    m_stream = &threadStream;
+  }
+}
+
+BufferedLogRecord::~BufferedLogRecord()
+{
+  const auto& message = m_stream->buffer.message;
+  m_backend.submit(m_level, m_logger.getModuleName(), message.data(), message.size());
+
+  if (m_nestedStream == nullptr) {
+    m_stream->reset();
+    m_stream->isInUse = false;
+  }
+}
+
+std::ostream&
+BufferedLogRecord::stream()
+{
+  return m_stream->os;
+}
+
+} // namespace detail
+
 } // namespace util
 } // namespace ndn
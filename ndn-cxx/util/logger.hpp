@@ -38,6 +38,9 @@ namespace ndn {
 namespace util {
 
 /** \brief Indicates the severity level of a log message.
+ *
+ *  If ndn-cxx is configured with `--with-max-log-level`, messages more verbose than that
+ *  level are removed at compile time, regardless of the levels set at runtime.
  */
 enum class LogLevel {
   FATAL   = -1,   ///< fatal (will be logged unconditionally)
@@ -128,6 +131,40 @@ template<class T>
 using ArgumentType = typename ExtractArgument<T>::type;
 /** \endcond */
 
+class BufferedLogBackend;
+
+/** \brief Get the buffered logging backend if it is in use.
+ *  \return nullptr if log messages go through Boost.Log
+ *  \sa Logging::setBufferedDestination
+ */
+BufferedLogBackend*
+getBufferedLogBackend();
+
+/** \brief Formats a log message for the buffered logging backend.
+ *
+ *  The message is written into a reusable thread-local buffer, which is submitted to the
+ *  backend when the object is destroyed.
+ */
+class BufferedLogRecord : noncopyable
+{
+public:
+  BufferedLogRecord(BufferedLogBackend& backend, const Logger& logger, LogLevel level);
+
+  ~BufferedLogRecord();
+
+  std::ostream&
+  stream();
+
+private:
+  class Stream;
+
+  BufferedLogBackend& m_backend;
+  const Logger& m_logger;
+  const LogLevel m_level;
+  Stream* m_stream;
+  unique_ptr<Stream> m_nestedStream; ///< used if the thread-local buffer is busy
+};
+
 } // namespace detail
 
 /** \cond */
@@ -233,12 +270,29 @@ using ArgumentType = typename ExtractArgument<T>::type;
   struct ndn_cxx_allow_trailing_semicolon
 
 /** \cond */
+// implementation detail
+#ifdef NDN_CXX_MAX_LOG_LEVEL
+#define NDN_LOG_IS_COMPILED(lvl) \
+  (static_cast<int>(::ndn::util::LogLevel::lvl) <= NDN_CXX_MAX_LOG_LEVEL)
+#else
+#define NDN_LOG_IS_COMPILED(lvl) true
+#endif
+
 // implementation detail
 #define NDN_LOG_INTERNAL(lvl, expression) \
   do { \
-    if (ndn_cxx_getLogger().isLevelEnabled(::ndn::util::LogLevel::lvl)) { \
-      BOOST_LOG_SEV(ndn_cxx_getLogger(), ::ndn::util::LogLevel::lvl)  \
-        << expression; \
+    if (NDN_LOG_IS_COMPILED(lvl) && \
+        ndn_cxx_getLogger().isLevelEnabled(::ndn::util::LogLevel::lvl)) { \
+      auto ndn_cxx_bufferedBackend = ::ndn::util::detail::getBufferedLogBackend(); \
+      if (ndn_cxx_bufferedBackend != nullptr) { \
+        ::ndn::util::detail::BufferedLogRecord(*ndn_cxx_bufferedBackend, ndn_cxx_getLogger(), \
+                                               ::ndn::util::LogLevel::lvl).stream() \
+          << expression; \
+      } \
+      else { \
+        BOOST_LOG_SEV(ndn_cxx_getLogger(), ::ndn::util::LogLevel::lvl)  \
+          << expression; \
+      } \
     } \
   } while (false)
 /** \endcond */
@@ -22,6 +22,7 @@
 #include "ndn-cxx/util/logging.hpp"
 #include "ndn-cxx/util/logger.hpp"
 #include "ndn-cxx/util/time.hpp"
+#include "ndn-cxx/util/impl/buffered-log-backend.hpp"
 
 #ifdef __ANDROID__
 #include "ndn-cxx/util/impl/logger-android.hpp"
@@ -36,9 +37,7 @@
 #include <boost/range/algorithm/copy.hpp>
 #include <boost/range/iterator_range.hpp>
 
-#include <cinttypes> // for PRIdLEAST64
-#include <cstdio>    // for std::snprintf()
-#include <cstdlib>   // for std::abs()
+#include <cstdlib>
 #include <iostream>
 #include <sstream>
 
@@ -49,26 +48,7 @@ namespace log {
 static std::string
 makeTimestamp()
 {
-  using namespace ndn::time;
-
-  const auto sinceEpoch = system_clock::now().time_since_epoch();
-  BOOST_ASSERT(sinceEpoch.count() >= 0);
-  // use abs() to silence truncation warning in snprintf(), see #4365
-  const auto usecs = std::abs(duration_cast<microseconds>(sinceEpoch).count());
-  const auto usecsPerSec = microseconds::period::den;
-
-  // 10 (whole seconds) + '.' + 6 (fraction) + '\0'
-  std::string buffer(10 + 1 + 6 + 1, '\0'); // note 1 extra byte still needed for snprintf
-  BOOST_ASSERT_MSG(usecs / usecsPerSec <= 9999999999, "whole seconds cannot fit in 10 characters");
-
-  static_assert(std::is_same<microseconds::rep, int_least64_t>::value,
-                "PRIdLEAST64 is incompatible with microseconds::rep");
-  std::snprintf(&buffer.front(), buffer.size(), "%" PRIdLEAST64 ".%06" PRIdLEAST64,
-                usecs / usecsPerSec, usecs % usecsPerSec);
-
-  // need to remove extra 1 byte ('\0')
-  buffer.pop_back();
-  return buffer;
+  return detail::formatLogTimestamp(time::system_clock::now());
 }
 
 BOOST_LOG_ATTRIBUTE_KEYWORD(timestamp, "Timestamp", std::string)
@@ -99,6 +79,12 @@ Logging::Logging()
   // cannot call the static setDestination(), as the singleton object is not yet constructed
   this->setDestinationImpl(std::move(destination));
 
+#ifndef __ANDROID__
+  if (std::getenv("NDN_LOG_BUFFERED") != nullptr) {
+    this->setBufferedDestinationImpl(shared_ptr<std::ostream>(&std::clog, [] (auto&&) {}));
+  }
+#endif // __ANDROID__
+
   const char* env = std::getenv("NDN_LOG");
   if (env != nullptr) {
     this->setLevelImpl(env);
@@ -291,6 +277,8 @@ Logging::setDestinationImpl(boost::shared_ptr<boost::log::sinks::sink> destinati
 {
   std::lock_guard<std::mutex> lock(m_mutex);
 
+  disableBufferedBackend();
+
   if (destination == m_destination) {
     return;
   }
@@ -307,6 +295,34 @@ Logging::setDestinationImpl(boost::shared_ptr<boost::log::sinks::sink> destinati
   }
 }
 
+void
+Logging::setBufferedDestinationImpl(shared_ptr<std::ostream> os)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (os == nullptr) {
+    disableBufferedBackend();
+    return;
+  }
+
+  if (m_bufferedBackend == nullptr) {
+    m_bufferedBackend = make_unique<detail::BufferedLogBackend>();
+  }
+  m_bufferedBackend->setOutput(std::move(os));
+  m_activeBufferedBackend.store(m_bufferedBackend.get(), std::memory_order_release);
+}
+
+void
+Logging::disableBufferedBackend()
+{
+  auto backend = m_activeBufferedBackend.exchange(nullptr, std::memory_order_acq_rel);
+  if (backend != nullptr) {
+    backend->flush();
+    // messages submitted concurrently with the switch are discarded
+    backend->setOutput(nullptr);
+  }
+}
+
 #ifdef NDN_CXX_HAVE_TESTS
 boost::shared_ptr<boost::log::sinks::sink>
 Logging::getDestination() const
@@ -335,10 +351,25 @@ Logging::flushImpl()
 {
   std::lock_guard<std::mutex> lock(m_mutex);
 
+  auto backend = m_activeBufferedBackend.load(std::memory_order_acquire);
+  if (backend != nullptr) {
+    backend->flush();
+  }
+
   if (m_destination != nullptr) {
     m_destination->flush();
   }
 }
 
+namespace detail {
+
+BufferedLogBackend*
+getBufferedLogBackend()
+{
+  return Logging::get().m_activeBufferedBackend.load(std::memory_order_acquire);
+}
+
+} // namespace detail
+
 } // namespace util
 } // namespace ndn
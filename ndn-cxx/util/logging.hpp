@@ -29,6 +29,7 @@
 #else
 
 #include <boost/log/sinks.hpp>
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 
@@ -38,6 +39,13 @@ namespace util {
 enum class LogLevel;
 class Logger;
 
+namespace detail {
+class BufferedLogBackend;
+
+BufferedLogBackend*
+getBufferedLogBackend();
+} // namespace detail
+
 /** \brief Controls the logging facility.
  *
  *  \note Public static methods are thread safe.
@@ -105,6 +113,28 @@ public:
   static void
   setDestination(std::ostream& os, bool wantAutoFlush);
 
+  /** \brief Write log messages to \p os through the buffered logging backend.
+   *  \param os a stream for log output, or nullptr to go back to the Boost.Log destination
+   *
+   *  Instead of creating a Boost.Log record, each enabled message is formatted into a reusable
+   *  thread-local buffer and copied, together with its timestamp, severity, and module name,
+   *  into a lock-free ring buffer owned by the logging thread.  A background thread collects
+   *  the records of all threads, formats them as the default stream destination does, and
+   *  writes them to \p os.  Messages are only approximately ordered by time: the messages
+   *  collected in one pass are sorted by timestamp, but a message of one thread may be written
+   *  after a later message of another thread that was collected in an earlier pass.
+   *  Logging never waits for the background thread: a mutex is only taken briefly for the
+   *  first message of each thread and to wake up the background thread when it is idle.
+   *  If the ring buffer of a thread is full, the message is dropped and the number of dropped
+   *  messages is written to \p os.
+   *
+   *  The buffered backend is also selected at startup if the environment variable
+   *  `NDN_LOG_BUFFERED` is set, with `std::clog` as output.  Calling setDestination() goes
+   *  back to the Boost.Log destination.
+   */
+  static void
+  setBufferedDestination(shared_ptr<std::ostream> os);
+
   /** \brief Flush log backend.
    *
    *  This ensures all log messages are written to the destination stream.
@@ -153,6 +183,15 @@ private:
   void
   setDestinationImpl(boost::shared_ptr<boost::log::sinks::sink> sink);
 
+  void
+  setBufferedDestinationImpl(shared_ptr<std::ostream> os);
+
+  /** \brief Stop using the buffered backend, writing out its pending messages.
+   *  \pre m_mutex is held
+   */
+  void
+  disableBufferedBackend();
+
   void
   flushImpl();
 
@@ -179,12 +218,16 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
 private:
   friend Logger;
+  friend detail::BufferedLogBackend* detail::getBufferedLogBackend();
 
   mutable std::mutex m_mutex;
   std::unordered_map<std::string, LogLevel> m_enabledLevel; ///< module prefix => minimum level
   std::unordered_multimap<std::string, Logger*> m_loggers; ///< module name => logger instance
 
   boost::shared_ptr<boost::log::sinks::sink> m_destination;
+
+  unique_ptr<detail::BufferedLogBackend> m_bufferedBackend; ///< created on first use
+  std::atomic<detail::BufferedLogBackend*> m_activeBufferedBackend{nullptr};
 };
 
 inline std::set<std::string>
@@ -211,6 +254,12 @@ Logging::setDestination(boost::shared_ptr<boost::log::sinks::sink> destination)
   get().setDestinationImpl(std::move(destination));
 }
 
+inline void
+Logging::setBufferedDestination(shared_ptr<std::ostream> os)
+{
+  get().setBufferedDestinationImpl(std::move(os));
+}
+
 inline void
 Logging::flush()
 {
@@ -35,12 +35,43 @@ RegexComponentMatcher::RegexComponentMatcher(const std::string& expr,
   compile();
 }
 
+optional<name::Component>
+RegexComponentMatcher::parseLiteral(const std::string& expr)
+{
+  if (expr.find_first_of(".[]{}()\\*+?|^$") != std::string::npos) {
+    return nullopt;
+  }
+
+  try {
+    auto component = name::Component::fromEscapedString(expr);
+    if (component.toUri() == expr) {
+      return component;
+    }
+  }
+  catch (const name::Component::Error&) {
+  }
+  return nullopt;
+}
+
 void
 RegexComponentMatcher::compile()
 {
+  m_pseudoMatchers.clear();
+
+  if (m_expr.empty() || m_expr == ".*") {
+    m_isWildcard = true;
+    m_pseudoMatchers.push_back(make_shared<RegexPseudoMatcher>());
+    return;
+  }
+
+  m_literal = parseLiteral(m_expr);
+  if (m_literal) {
+    m_pseudoMatchers.push_back(make_shared<RegexPseudoMatcher>());
+    return;
+  }
+
   m_componentRegex.assign(m_expr);
 
-  m_pseudoMatchers.clear();
   m_pseudoMatchers.push_back(make_shared<RegexPseudoMatcher>());
 
   for (size_t i = 1; i <= m_componentRegex.mark_count(); i++) {
@@ -62,6 +93,19 @@ RegexComponentMatcher::match(const Name& name, size_t offset, size_t len)
   if (!m_isExactMatch)
     NDN_THROW(Error("Non-exact component search is not supported yet"));
 
+  if (m_isWildcard) {
+    m_matchResult.push_back(name.get(offset));
+    return true;
+  }
+
+  if (m_literal) {
+    if (name.get(offset) != *m_literal) {
+      return false;
+    }
+    m_matchResult.push_back(name.get(offset));
+    return true;
+  }
+
   std::smatch subResult;
   std::string targetStr = name.get(offset).toUri();
   if (std::regex_match(targetStr, subResult, m_componentRegex)) {
@@ -76,4 +120,36 @@ RegexComponentMatcher::match(const Name& name, size_t offset, size_t len)
   return false;
 }
 
+void
+RegexComponentMatcher::findMatchEnds(const Name& name, const std::vector<bool>& starts,
+                                     std::vector<bool>& ends) const
+{
+  for (size_t i = 0; i < name.size(); ++i) {
+    if (starts[i] && matchesComponent(name[i])) {
+      ends[i + 1] = true;
+    }
+  }
+}
+
+bool
+RegexComponentMatcher::matchesComponent(const name::Component& component) const
+{
+  if (m_expr.empty()) {
+    return true;
+  }
+
+  if (!m_isExactMatch)
+    NDN_THROW(Error("Non-exact component search is not supported yet"));
+
+  if (m_isWildcard) {
+    return true;
+  }
+
+  if (m_literal) {
+    return component == *m_literal;
+  }
+
+  return std::regex_match(component.toUri(), m_componentRegex);
+}
+
 } // namespace ndn
@@ -48,12 +48,36 @@ public:
   bool
   match(const Name& name, size_t offset, size_t len = 1) override;
 
+  void
+  findMatchEnds(const Name& name, const std::vector<bool>& starts,
+                std::vector<bool>& ends) const override;
+
+  /**
+   * @brief Check whether @p component matches the expression, without recording match results
+   */
+  bool
+  matchesComponent(const name::Component& component) const;
+
+  /**
+   * @brief Return the only component that matches @p expr, if @p expr is a literal
+   *
+   * A component matches an expression iff its default URI representation matches it. An
+   * expression without regex special characters that is also the default URI representation of
+   * a component therefore matches exactly that component.
+   */
+  static optional<name::Component>
+  parseLiteral(const std::string& expr);
+
 private:
   void
   compile();
 
 private:
   bool m_isExactMatch;
+  /// the expression matches every component
+  bool m_isWildcard = false;
+  /// if set, the expression matches only this component, which is compared on its TLV encoding
+  optional<name::Component> m_literal;
   std::regex m_componentRegex;
   std::vector<shared_ptr<RegexPseudoMatcher>> m_pseudoMatchers;
 };
@@ -24,6 +24,8 @@
 #include "ndn-cxx/util/regex/regex-component-set-matcher.hpp"
 #include "ndn-cxx/util/regex/regex-component-matcher.hpp"
 
+#include <algorithm>
+
 namespace ndn {
 
 RegexComponentSetMatcher::RegexComponentSetMatcher(const std::string& expr,
@@ -118,6 +120,23 @@ RegexComponentSetMatcher::match(const Name& name, size_t offset, size_t len)
   return false;
 }
 
+void
+RegexComponentSetMatcher::findMatchEnds(const Name& name, const std::vector<bool>& starts,
+                                        std::vector<bool>& ends) const
+{
+  for (size_t i = 0; i < name.size(); ++i) {
+    if (!starts[i]) {
+      continue;
+    }
+
+    bool isMatched = std::any_of(m_components.begin(), m_components.end(),
+                                 [&] (const auto& comp) { return comp->matchesComponent(name[i]); });
+    if (m_isInclusion ? isMatched : !isMatched) {
+      ends[i + 1] = true;
+    }
+  }
+}
+
 size_t
 RegexComponentSetMatcher::extractComponent(size_t index) const
 {
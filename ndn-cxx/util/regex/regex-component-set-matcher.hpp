@@ -46,6 +46,10 @@ public:
   bool
   match(const Name& name, size_t offset, size_t len = 1) override;
 
+  void
+  findMatchEnds(const Name& name, const std::vector<bool>& starts,
+                std::vector<bool>& ends) const override;
+
 private:
   void
   compile();
@@ -52,6 +52,26 @@ RegexMatcher::match(const Name& name, size_t offset, size_t len)
   return false;
 }
 
+void
+RegexMatcher::findMatchEnds(const Name& name, const std::vector<bool>& starts,
+                            std::vector<bool>& ends) const
+{
+  // the sub-matchers are matched in sequence
+  std::vector<bool> current = starts;
+  std::vector<bool> next(current.size());
+  for (const auto& matcher : m_matchers) {
+    next.assign(current.size(), false);
+    matcher->findMatchEnds(name, current, next);
+    current.swap(next);
+  }
+
+  for (size_t i = 0; i < current.size(); ++i) {
+    if (current[i]) {
+      ends[i] = true;
+    }
+  }
+}
+
 bool
 RegexMatcher::recursiveMatch(size_t matcherNo, const Name& name, size_t offset, size_t len)
 {
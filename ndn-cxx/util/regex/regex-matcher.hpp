@@ -54,6 +54,22 @@ public:
   virtual bool
   match(const Name& name, size_t offset, size_t len);
 
+  /**
+   * @brief Find where matches of this expression can end, without recording match results
+   *
+   * For every offset @c i such that @p starts[i] is set, sets @p ends[j] for every offset @c j
+   * such that the name components in [i, j) match this expression. All matches are explored at
+   * once as sets of offsets, so the cost is polynomial in the name length instead of requiring
+   * backtracking. This method does not modify the matcher, so a matcher can be shared by
+   * multiple threads that only use this method.
+   *
+   * @param name the name to match
+   * @param starts flags indexed by offset, of size name.size() + 1
+   * @param[out] ends flags indexed by offset, of size name.size() + 1; flags are only set
+   */
+  virtual void
+  findMatchEnds(const Name& name, const std::vector<bool>& starts, std::vector<bool>& ends) const;
+
   const std::string&
   getExpr() const
   {
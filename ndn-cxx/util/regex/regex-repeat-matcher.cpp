@@ -141,6 +141,69 @@ RegexRepeatMatcher::match(const Name& name, size_t offset, size_t len)
   return false;
 }
 
+void
+RegexRepeatMatcher::findMatchEnds(const Name& name, const std::vector<bool>& starts,
+                                  std::vector<bool>& ends) const
+{
+  const auto& matcher = m_matchers[0];
+  std::vector<bool> reached(starts.size());
+  std::vector<bool> frontier(starts.size());
+  std::vector<bool> next(starts.size());
+
+  for (size_t start = 0; start < starts.size(); ++start) {
+    if (!starts[start]) {
+      continue;
+    }
+
+    // reached: offsets at which at least m_repeatMin repetitions can end
+    reached.assign(starts.size(), false);
+    frontier.assign(starts.size(), false);
+    frontier[start] = true;
+    if (m_repeatMin == 0) {
+      reached[start] = true;
+    }
+
+    size_t repeat = 0;
+    bool hasFrontier = true;
+    while (hasFrontier && repeat < m_repeatMax) {
+      next.assign(starts.size(), false);
+      matcher->findMatchEnds(name, frontier, next);
+      ++repeat;
+
+      hasFrontier = false;
+      for (size_t i = 0; i < next.size(); ++i) {
+        if (!next[i]) {
+          continue;
+        }
+        if (repeat < m_repeatMin) {
+          // below the minimum, every offset must be carried to the next repetition
+          hasFrontier = true;
+        }
+        else if (reached[i]) {
+          // already reached with fewer repetitions, which leaves more repetitions available
+          next[i] = false;
+        }
+        else {
+          reached[i] = true;
+          hasFrontier = true;
+        }
+      }
+      frontier.swap(next);
+    }
+
+    // like match(), a repetition with a non-zero minimum never matches an empty sequence
+    if (m_repeatMin > 0) {
+      reached[start] = false;
+    }
+
+    for (size_t i = 0; i < reached.size(); ++i) {
+      if (reached[i]) {
+        ends[i] = true;
+      }
+    }
+  }
+}
+
 bool
 RegexRepeatMatcher::recursiveMatch(size_t repeat, const Name& name, size_t offset, size_t len)
 {
@@ -38,6 +38,10 @@ public:
   bool
   match(const Name& name, size_t offset, size_t len) override;
 
+  void
+  findMatchEnds(const Name& name, const std::vector<bool>& starts,
+                std::vector<bool>& ends) const override;
+
 private:
   void
   compile();
@@ -24,6 +24,7 @@
 #include "ndn-cxx/util/regex/regex-top-matcher.hpp"
 
 #include "ndn-cxx/util/regex/regex-backref-manager.hpp"
+#include "ndn-cxx/util/regex/regex-component-matcher.hpp"
 #include "ndn-cxx/util/regex/regex-pattern-list-matcher.hpp"
 
 #include <boost/lexical_cast.hpp>
@@ -88,6 +89,59 @@ RegexTopMatcher::match(const Name& name, size_t, size_t)
   return match(name);
 }
 
+bool
+RegexTopMatcher::doesMatch(const Name& name) const
+{
+  std::vector<bool> starts(name.size() + 1);
+  starts[0] = true;
+  std::vector<bool> ends(name.size() + 1);
+
+  m_primaryMatcher->findMatchEnds(name, starts, ends);
+  if (!ends.back() && m_secondaryMatcher != nullptr) {
+    m_secondaryMatcher->findMatchEnds(name, starts, ends);
+  }
+  return ends.back();
+}
+
+void
+RegexTopMatcher::findMatchEnds(const Name& name, const std::vector<bool>& starts,
+                               std::vector<bool>& ends) const
+{
+  // like match(), the top-level matcher always matches the entire name
+  if (starts[0] && doesMatch(name)) {
+    ends[name.size()] = true;
+  }
+}
+
+Name
+RegexTopMatcher::getLiteralPrefix() const
+{
+  Name prefix;
+  if (m_expr.empty() || m_expr[0] != '^') {
+    return prefix;
+  }
+
+  size_t pos = 1;
+  while (pos < m_expr.size() && m_expr[pos] == '<') {
+    size_t end = m_expr.find('>', pos);
+    if (end == std::string::npos) {
+      break;
+    }
+    // a repeated component is not part of the prefix
+    if (end + 1 < m_expr.size() && std::string("*+?{").find(m_expr[end + 1]) != std::string::npos) {
+      break;
+    }
+
+    auto literal = RegexComponentMatcher::parseLiteral(m_expr.substr(pos + 1, end - pos - 1));
+    if (!literal) {
+      break;
+    }
+    prefix.append(*literal);
+    pos = end + 1;
+  }
+  return prefix;
+}
+
 Name
 RegexTopMatcher::expand(const std::string& expandStr)
 {
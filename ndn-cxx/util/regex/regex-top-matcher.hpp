@@ -43,6 +43,29 @@ public:
   bool
   match(const Name& name, size_t offset, size_t len) override;
 
+  /**
+   * @brief Check whether @p name matches the expression, without recording match results
+   *
+   * Unlike match(), this method does not modify the matcher and never backtracks, so a single
+   * compiled matcher can be shared by multiple threads. expand() cannot be used after this
+   * method; use match() when the matched components or back references are needed.
+   */
+  bool
+  doesMatch(const Name& name) const;
+
+  void
+  findMatchEnds(const Name& name, const std::vector<bool>& starts,
+                std::vector<bool>& ends) const override;
+
+  /**
+   * @brief Return a prefix shared by every name that matches the expression
+   *
+   * The prefix consists of the literal components at the beginning of an anchored expression,
+   * e.g., `/ndn/KEY` for `^<ndn><KEY><>*$`. It is empty if the expression is not anchored.
+   */
+  Name
+  getLiteralPrefix() const;
+
   virtual Name
   expand(const std::string& expand = "");
 
@@ -19,10 +19,16 @@
  * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
  */
 
+
 #include "ndn-cxx/util/scheduler.hpp"
+#include "ndn-cxx/util/optional.hpp"
 #include "ndn-cxx/util/impl/steady-timer.hpp"
 #include "ndn-cxx/util/scope.hpp"
 
+#include <array>
+#include <mutex>
+#include <vector>
+
 namespace ndn {
 namespace scheduler {
 
@@ -48,8 +54,347 @@ public:
   Scheduler::EventQueue::const_iterator queueIt;
   time::steady_clock::TimePoint expireTime;
   bool isExpired = false;
+
+  // timing wheel slot list, the owning pointer is held by the predecessor or the slot
+  shared_ptr<EventInfo> wheelNext;
+  EventInfo* wheelPrev = nullptr;
+  uint64_t expireTick = 0;
+};
+
+/** \brief Free list of fixed-size memory blocks, used to recycle EventInfo allocations
+ *
+ *  The pool is shared between the Scheduler and every allocated event, because an event's
+ *  memory is released only after the last EventId referring to it goes away. EventIds may be
+ *  destroyed on any thread, so the free list is protected by a mutex.
+ */
+class EventPool : noncopyable
+{
+public:
+  ~EventPool()
+  {
+    for (void* block : m_freeBlocks) {
+      ::operator delete(block);
+    }
+  }
+
+  void*
+  allocate(size_t size)
+  {
+    if (m_blockSize == 0) {
+      // the first allocation determines the block size
+      m_blockSize = size;
+    }
+    if (size == m_blockSize) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_freeBlocks.empty()) {
+        void* block = m_freeBlocks.back();
+        m_freeBlocks.pop_back();
+        return block;
+      }
+    }
+    return ::operator new(size);
+  }
+
+  void
+  deallocate(void* block, size_t size) noexcept
+  {
+    if (size == m_blockSize) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_freeBlocks.size() < MAX_FREE_BLOCKS) {
+        try {
+          m_freeBlocks.push_back(block);
+          return;
+        }
+        catch (const std::bad_alloc&) {
+        }
+      }
+    }
+    ::operator delete(block);
+  }
+
+private:
+  /** \brief Upper bound of retained blocks, so that a burst of events does not pin memory forever
+   */
+  static constexpr size_t MAX_FREE_BLOCKS = 1 << 16;
+
+  std::mutex m_mutex;
+  std::vector<void*> m_freeBlocks;
+  size_t m_blockSize = 0; ///< set by the first allocation, which happens on the scheduler's thread
+};
+
+/** \brief Allocator for std::allocate_shared that draws memory from an EventPool
+ */
+template<typename T>
+class EventAllocator
+{
+public:
+  using value_type = T;
+
+  explicit
+  EventAllocator(shared_ptr<EventPool> pool) noexcept
+    : m_pool(std::move(pool))
+  {
+  }
+
+  template<typename U>
+  EventAllocator(const EventAllocator<U>& other) noexcept
+    : m_pool(other.m_pool)
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    return static_cast<T*>(m_pool->allocate(n * sizeof(T)));
+  }
+
+  void
+  deallocate(T* p, size_t n) noexcept
+  {
+    m_pool->deallocate(p, n * sizeof(T));
+  }
+
+  template<typename U>
+  bool
+  operator==(const EventAllocator<U>& other) const noexcept
+  {
+    return m_pool == other.m_pool;
+  }
+
+  template<typename U>
+  bool
+  operator!=(const EventAllocator<U>& other) const noexcept
+  {
+    return m_pool != other.m_pool;
+  }
+
+private:
+  shared_ptr<EventPool> m_pool;
+
+  template<typename U>
+  friend class EventAllocator;
+};
+
+/** \brief Hashed timing wheel with millisecond ticks
+ *
+ *  Each slot holds a FIFO list of the events expiring at a tick congruent to the slot index.
+ *  Events further than one revolution in the future stay in their slot and are skipped until
+ *  the wheel reaches their tick. A bitmap of non-empty slots allows the wheel to jump over
+ *  idle periods instead of waking up on every tick.
+ */
+class Scheduler::TimingWheel : noncopyable
+{
+public:
+  TimingWheel()
+    : m_origin(time::steady_clock::now())
+  {
+  }
+
+  ~TimingWheel()
+  {
+    clear();
+  }
+
+  /** \brief Insert an event
+   *  \return whether the event expires before the tick last returned by nextExpiry()
+   */
+  bool
+  insert(const shared_ptr<EventInfo>& info)
+  {
+    if (m_size == 0) {
+      m_currentTick = std::max(m_currentTick, toTick(time::steady_clock::now()));
+    }
+
+    // never insert into the slot being drained, otherwise the event would be delayed a revolution
+    uint64_t tick = std::max(toTick(info->expireTime, true), m_currentTick + 1);
+    info->expireTick = tick;
+
+    Slot& slot = m_slots[tick % N_SLOTS];
+    info->wheelPrev = slot.tail;
+    if (slot.tail == nullptr) {
+      slot.head = info;
+      m_nonEmpty[(tick % N_SLOTS) / 64] |= uint64_t(1) << (tick % 64);
+    }
+    else {
+      slot.tail->wheelNext = info;
+    }
+    slot.tail = info.get();
+    ++m_size;
+
+    return !m_nextTick || tick < *m_nextTick;
+  }
+
+  /** \brief Remove an event
+   *  \pre the event is in the wheel
+   *  \return the owning pointer of the event
+   */
+  shared_ptr<EventInfo>
+  erase(EventInfo& info)
+  {
+    size_t index = info.expireTick % N_SLOTS;
+    Slot& slot = m_slots[index];
+
+    shared_ptr<EventInfo>& owner = info.wheelPrev == nullptr ? slot.head : info.wheelPrev->wheelNext;
+    shared_ptr<EventInfo> self = std::move(owner);
+    owner = std::move(info.wheelNext);
+    if (owner == nullptr) {
+      slot.tail = info.wheelPrev;
+    }
+    else {
+      owner->wheelPrev = info.wheelPrev;
+    }
+    info.wheelPrev = nullptr;
+
+    if (slot.head == nullptr) {
+      m_nonEmpty[index / 64] &= ~(uint64_t(1) << (index % 64));
+    }
+    if (--m_size == 0) {
+      // the timer is cancelled when the wheel becomes empty, so the next insertion must set it
+      m_nextTick = nullopt;
+    }
+    return self;
+  }
+
+  /** \brief Remove and return the next event that has expired as of \p now
+   *  \return the expired event, or nullptr if there is none
+   */
+  shared_ptr<EventInfo>
+  popExpired(time::steady_clock::TimePoint now)
+  {
+    uint64_t nowTick = toTick(now);
+    while (m_size > 0) {
+      EventInfo* info = findExpired(m_currentTick);
+      if (info != nullptr) {
+        return erase(*info);
+      }
+      if (m_currentTick >= nowTick) {
+        return nullptr;
+      }
+      // jump to the next non-empty slot, but not past the current time
+      m_currentTick = std::min(m_currentTick + distanceToNextSlot(m_currentTick), nowTick);
+    }
+    m_currentTick = std::max(m_currentTick, nowTick);
+    return nullptr;
+  }
+
+  /** \brief Return when the next event expires, or nullopt if the wheel is empty
+   *
+   *  The returned time point may be earlier than the actual expiration of any event, if the
+   *  earliest non-empty slot contains only events due in a later revolution.
+   */
+  optional<time::steady_clock::TimePoint>
+  nextExpiry()
+  {
+    if (m_size == 0) {
+      m_nextTick = nullopt;
+      return nullopt;
+    }
+
+    // the current slot can still hold expired events if a callback has thrown
+    m_nextTick = findExpired(m_currentTick) != nullptr ? m_currentTick :
+                 m_currentTick + distanceToNextSlot(m_currentTick);
+    return m_origin + time::milliseconds(*m_nextTick);
+  }
+
+  bool
+  empty() const noexcept
+  {
+    return m_size == 0;
+  }
+
+  void
+  clear() noexcept
+  {
+    for (Slot& slot : m_slots) {
+      // unlink iteratively, to avoid deep recursion when destroying a long list
+      // the list is kept consistent, as destroying a callback may cancel another event
+      while (slot.head != nullptr) {
+        shared_ptr<EventInfo> info = std::move(slot.head);
+        slot.head = std::move(info->wheelNext);
+        if (slot.head == nullptr) {
+          slot.tail = nullptr;
+        }
+        else {
+          slot.head->wheelPrev = nullptr;
+        }
+      }
+    }
+    m_nonEmpty.fill(0);
+    m_size = 0;
+    m_nextTick = nullopt;
+  }
+
+private:
+  uint64_t
+  toTick(time::steady_clock::TimePoint t, bool shouldRoundUp = false) const
+  {
+    if (t <= m_origin) {
+      return 0;
+    }
+    auto elapsed = t - m_origin;
+    auto tick = time::duration_cast<time::milliseconds>(elapsed);
+    return static_cast<uint64_t>(tick.count()) + (shouldRoundUp && tick < elapsed ? 1 : 0);
+  }
+
+  EventInfo*
+  findExpired(uint64_t tick) const
+  {
+    for (EventInfo* info = m_slots[tick % N_SLOTS].head.get(); info != nullptr;
+         info = info->wheelNext.get()) {
+      if (info->expireTick <= tick) {
+        return info;
+      }
+    }
+    return nullptr;
+  }
+
+  /** \brief Return the distance, in [1, N_SLOTS], from \p tick to the next non-empty slot
+   *  \pre the wheel is not empty
+   */
+  uint64_t
+  distanceToNextSlot(uint64_t tick) const
+  {
+    size_t index = (tick + 1) % N_SLOTS;
+    uint64_t distance = 1;
+    while (distance <= N_SLOTS) {
+      uint64_t word = m_nonEmpty[index / 64] >> (index % 64);
+      if (word != 0) {
+        while ((word & 1) == 0) {
+          word >>= 1;
+          ++distance;
+        }
+        return std::min<uint64_t>(distance, N_SLOTS);
+      }
+      uint64_t skip = 64 - index % 64;
+      distance += skip;
+      index = (index + skip) % N_SLOTS;
+    }
+    return N_SLOTS;
+  }
+
+private:
+  /** \brief Number of slots, i.e., number of ticks in one revolution
+   *
+   *  One revolution covers the default Interest lifetime with some headroom.
+   */
+  static constexpr size_t N_SLOTS = 8192;
+
+  struct Slot
+  {
+    shared_ptr<EventInfo> head;
+    EventInfo* tail = nullptr;
+  };
+
+  std::array<Slot, N_SLOTS> m_slots;
+  std::array<uint64_t, N_SLOTS / 64> m_nonEmpty{};
+  const time::steady_clock::TimePoint m_origin;
+  uint64_t m_currentTick = 0; ///< the tick being processed
+  optional<uint64_t> m_nextTick; ///< the tick at which the timer is set to expire
+  size_t m_size = 0;
 };
 
+constexpr size_t Scheduler::TimingWheel::N_SLOTS;
+
 EventId::EventId(Scheduler& sched, weak_ptr<EventInfo> info)
   : CancelHandle([&sched, info] { sched.cancelImpl(info.lock()); })
   , m_info(std::move(info))
@@ -81,9 +426,13 @@ Scheduler::EventQueueCompare::operator()(const shared_ptr<EventInfo>& a,
   return a->expireTime < b->expireTime;
 }
 
-Scheduler::Scheduler(boost::asio::io_service& ioService)
+Scheduler::Scheduler(boost::asio::io_service& ioService, QueueType queueType)
   : m_timer(make_unique<util::detail::SteadyTimer>(ioService))
 {
+  if (queueType == QueueType::TIMING_WHEEL) {
+    m_wheel = make_unique<TimingWheel>();
+    m_pool = make_shared<EventPool>();
+  }
 }
 
 Scheduler::~Scheduler() = default;
@@ -93,15 +442,25 @@ Scheduler::schedule(time::nanoseconds after, EventCallback callback)
 {
   BOOST_ASSERT(callback != nullptr);
 
-  auto i = m_queue.insert(std::make_shared<EventInfo>(after, std::move(callback)));
-  (*i)->queueIt = i;
+  shared_ptr<EventInfo> info;
+  bool isFirstToExpire = false;
+  if (m_wheel != nullptr) {
+    info = std::allocate_shared<EventInfo>(EventAllocator<EventInfo>(m_pool), after, std::move(callback));
+    isFirstToExpire = m_wheel->insert(info);
+  }
+  else {
+    auto i = m_queue.insert(std::make_shared<EventInfo>(after, std::move(callback)));
+    (*i)->queueIt = i;
+    info = *i;
+    isFirstToExpire = i == m_queue.begin();
+  }
 
-  if (!m_isEventExecuting && i == m_queue.begin()) {
+  if (!m_isEventExecuting && isFirstToExpire) {
     // the new event is the first one to expire
     scheduleNext();
   }
 
-  return EventId(*this, *i);
+  return EventId(*this, info);
 }
 
 void
@@ -111,6 +470,15 @@ Scheduler::cancelImpl(const shared_ptr<EventInfo>& info)
     return;
   }
 
+  if (m_wheel != nullptr) {
+    // the timer is not rescheduled, waking up early is cheaper than searching the wheel
+    m_wheel->erase(*info);
+    if (m_wheel->empty()) {
+      m_timer->cancel();
+    }
+    return;
+  }
+
   if (info->queueIt == m_queue.begin()) {
     m_timer->cancel();
   }
@@ -125,12 +493,24 @@ void
 Scheduler::cancelAllEvents()
 {
   m_queue.clear();
+  if (m_wheel != nullptr) {
+    m_wheel->clear();
+  }
   m_timer->cancel();
 }
 
 void
 Scheduler::scheduleNext()
 {
+  if (m_wheel != nullptr) {
+    auto nextExpiry = m_wheel->nextExpiry();
+    if (nextExpiry) {
+      m_timer->expires_from_now(std::max(*nextExpiry - time::steady_clock::now(), 0_ns));
+      m_timer->async_wait([this] (const auto& error) { this->executeEvent(error); });
+    }
+    return;
+  }
+
   if (!m_queue.empty()) {
     m_timer->expires_from_now((*m_queue.begin())->expiresFromNow());
     m_timer->async_wait([this] (const auto& error) { this->executeEvent(error); });
@@ -152,6 +532,14 @@ Scheduler::executeEvent(const boost::system::error_code& error)
 
   // process all expired events
   auto now = time::steady_clock::now();
+  if (m_wheel != nullptr) {
+    while (auto info = m_wheel->popExpired(now)) {
+      info->isExpired = true;
+      info->callback();
+    }
+    return;
+  }
+
   while (!m_queue.empty()) {
     auto head = m_queue.begin();
     shared_ptr<EventInfo> info = *head;
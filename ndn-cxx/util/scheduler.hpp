@@ -41,6 +41,7 @@ namespace scheduler {
 
 class Scheduler;
 class EventInfo;
+class EventPool;
 
 /** \brief Function to be invoked when a scheduled event expires
  */
@@ -134,8 +135,27 @@ using ScopedEventId = detail::ScopedCancelHandle<EventId>;
 class Scheduler : noncopyable
 {
 public:
+  /** \brief Data structure used to keep track of scheduled events
+   */
+  enum class QueueType {
+    /** \brief Events are kept in a balanced tree ordered by expiration time.
+     *
+     *  Events are executed with the precision of the underlying timer. Scheduling and canceling
+     *  an event is O(log n).
+     */
+    ORDERED,
+    /** \brief Events are kept in a hashed timing wheel with millisecond granularity.
+     *
+     *  An event may be executed up to 1 millisecond later than requested, and events expiring
+     *  within the same millisecond are executed in the order they were scheduled. Scheduling and
+     *  canceling an event is O(1), and event records are recycled through a memory pool. This is
+     *  suitable for a large number of coarse timeouts, such as Interest lifetimes.
+     */
+    TIMING_WHEEL,
+  };
+
   explicit
-  Scheduler(boost::asio::io_service& ioService);
+  Scheduler(boost::asio::io_service& ioService, QueueType queueType = QueueType::ORDERED);
 
   ~Scheduler();
 
@@ -168,6 +188,8 @@ private:
   executeEvent(const boost::system::error_code& code);
 
 private:
+  class TimingWheel;
+
   class EventQueueCompare
   {
   public:
@@ -178,6 +200,10 @@ private:
   using EventQueue = std::multiset<shared_ptr<EventInfo>, EventQueueCompare>;
   EventQueue m_queue;
 
+  // the following are used only with QueueType::TIMING_WHEEL
+  unique_ptr<TimingWheel> m_wheel;
+  shared_ptr<EventPool> m_pool;
+
   unique_ptr<util::detail::SteadyTimer> m_timer;
   bool m_isEventExecuting = false;
 
@@ -23,7 +23,6 @@
 
 #include "ndn-cxx/util/segment-fetcher.hpp"
 #include "ndn-cxx/name-component.hpp"
-#include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/lp/nack-header.hpp"
 
@@ -271,12 +270,8 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
   // Remove from pending segments map
   m_pendingSegments.erase(pendingSegmentIt);
 
-  // Copy data in segment to temporary buffer
-  auto receivedSegmentIt = m_segmentBuffer.emplace(std::piecewise_construct,
-                                                   std::forward_as_tuple(currentSegment),
-                                                   std::forward_as_tuple(data.getContent().value_size()));
-  std::copy(data.getContent().value_begin(), data.getContent().value_end(),
-            receivedSegmentIt.first->second.begin());
+  // Keep the Content element, which shares the underlying buffer of the Data packet
+  m_segmentBuffer.emplace(currentSegment, data.getContent());
   m_nBytesReceived += data.getContent().value_size();
   afterSegmentValidated(data);
 
@@ -294,8 +289,13 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
 
   if (m_options.inOrder && m_nextSegmentInOrder == currentSegment) {
     do {
-      onInOrderData(std::make_shared<const Buffer>(m_segmentBuffer[m_nextSegmentInOrder]));
-      m_segmentBuffer.erase(m_nextSegmentInOrder++);
+      auto it = m_segmentBuffer.find(m_nextSegmentInOrder);
+      onInOrderContent(it->second);
+      if (!onInOrderData.isEmpty()) {
+        onInOrderData(std::make_shared<const Buffer>(it->second.value_begin(), it->second.value_end()));
+      }
+      m_segmentBuffer.erase(it);
+      ++m_nextSegmentInOrder;
     } while (m_segmentBuffer.count(m_nextSegmentInOrder) > 0);
   }
 
@@ -413,15 +413,29 @@ SegmentFetcher::finalizeFetch()
     onInOrderComplete();
   }
   else {
-    // Combine segments into final buffer
-    OBufferStream buf;
     // We may have received more segments than exist in the object.
     BOOST_ASSERT(m_receivedSegments.size() >= static_cast<uint64_t>(m_nSegments));
 
+    std::vector<Block> segments;
+    segments.reserve(m_nSegments);
+    size_t totalSize = 0;
     for (int64_t i = 0; i < m_nSegments; i++) {
-      buf.write(m_segmentBuffer[i].get<const char>(), m_segmentBuffer[i].size());
+      segments.push_back(m_segmentBuffer[i]);
+      totalSize += segments.back().value_size();
+    }
+    m_segmentBuffer.clear();
+
+    onCompleteContent(segments);
+
+    // Combine segments into final buffer, only if someone asked for it
+    if (!onComplete.isEmpty()) {
+      auto buf = std::make_shared<Buffer>(totalSize);
+      auto out = buf->begin();
+      for (const auto& segment : segments) {
+        out = std::copy(segment.value_begin(), segment.value_end(), out);
+      }
+      onComplete(std::move(buf));
     }
-    onComplete(buf.buf());
   }
   stop();
 }
@@ -60,9 +60,11 @@ namespace util {
  *    format: `/<prefix>/<version>/<segment=(N)>`.
  *
  * 4. If set to 'block' mode, signal #onComplete passing a memory buffer that combines the content
- *    of all segments in the object. If set to 'in order' mode, signal #onInOrderData is triggered
- *    upon validation of each segment in segment order, storing later segments that arrived out of
- *    order internally until all earlier segments have arrived and have been validated.
+ *    of all segments in the object, and #onCompleteContent passing the list of Content elements
+ *    without concatenating them. If set to 'in order' mode, signals #onInOrderData and
+ *    #onInOrderContent are triggered upon validation of each segment in segment order, storing
+ *    later segments that arrived out of order internally until all earlier segments have arrived
+ *    and have been validated.
  *
  * If an error occurs during the fetching process, #onError is signaled with one of the error codes
  * from SegmentFetcher::ErrorCode.
@@ -267,6 +269,26 @@ public:
    */
   Signal<SegmentFetcher, ConstBufferPtr> onInOrderData;
 
+  /**
+   * @brief Emitted after each data segment in segment order has been validated.
+   *
+   * The handler receives the Content element of the segment, which shares the memory of the
+   * received Data packet instead of copying it; the payload is available via Block::value_bytes().
+   * This allows streaming a large object to a file, a socket, or another sink, while memory usage
+   * stays bounded by the reorder buffer (see Options::flowControlWindow).
+   * @note Emitted only if SegmentFetcher is operating in 'in order' mode.
+   */
+  Signal<SegmentFetcher, Block> onInOrderContent;
+
+  /**
+   * @brief Emitted upon successful retrieval of the complete object (all segments).
+   *
+   * The handler receives the Content elements of all segments in segment order. Unlike
+   * #onComplete, the segments are not concatenated into a contiguous buffer.
+   * @note Emitted only if SegmentFetcher is operating in 'block' mode.
+   */
+  Signal<SegmentFetcher, std::vector<Block>> onCompleteContent;
+
   /**
    * @brief Emitted on successful retrieval of all segments in 'in order' mode.
    * @note Emitted only if SegmentFetcher is operating in 'in order' mode.
@@ -315,7 +337,7 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   int64_t m_nBytesReceived = 0;
   uint64_t m_nextSegmentInOrder = 0;
 
-  std::map<uint64_t, Buffer> m_segmentBuffer;
+  std::map<uint64_t, Block> m_segmentBuffer; ///< Content elements of received segments
   std::map<uint64_t, PendingSegment> m_pendingSegments;
   std::set<uint64_t> m_receivedSegments;
 };
@@ -22,53 +22,94 @@
 #include "ndn-cxx/util/sha256.hpp"
 #include "ndn-cxx/util/string-helper.hpp"
 #include "ndn-cxx/security/impl/openssl.hpp"
-#include "ndn-cxx/security/transform/digest-filter.hpp"
-#include "ndn-cxx/security/transform/stream-sink.hpp"
-#include "ndn-cxx/security/transform/stream-source.hpp"
+#include "ndn-cxx/security/impl/openssl-helper.hpp"
 
 namespace ndn {
 namespace util {
 
 const size_t Sha256::DIGEST_SIZE;
 
+static void
+initContext(EVP_MD_CTX* ctx)
+{
+  if (EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr) != 1) {
+    NDN_THROW(Sha256::Error("EVP_DigestInit_ex failed"));
+  }
+}
+
+static void
+updateContext(EVP_MD_CTX* ctx, span<const uint8_t> buffer)
+{
+  if (EVP_DigestUpdate(ctx, buffer.data(), buffer.size()) != 1) {
+    NDN_THROW(Sha256::Error("EVP_DigestUpdate failed"));
+  }
+}
+
+static void
+finalizeContext(EVP_MD_CTX* ctx, uint8_t* digest)
+{
+  if (EVP_DigestFinal_ex(ctx, digest, nullptr) != 1) {
+    NDN_THROW(Sha256::Error("EVP_DigestFinal_ex failed"));
+  }
+}
+
+/**
+ * @brief Returns the digest context reused by the stateless calculations of the calling thread.
+ */
+static EVP_MD_CTX*
+getThreadContext()
+{
+  thread_local security::detail::EvpMdCtx ctx;
+  return ctx;
+}
+
 Sha256::Sha256()
 {
   reset();
 }
 
 Sha256::Sha256(std::istream& is)
-  : m_output(make_unique<OBufferStream>())
-  , m_isEmpty(false)
-  , m_isFinalized(true)
+  : Sha256()
 {
-  namespace tr = security::transform;
-
-  tr::streamSource(is) >> tr::digestFilter(DigestAlgorithm::SHA256) >> tr::streamSink(*m_output);
+  std::array<char, 8192> chunk;
+  while (is.read(chunk.data(), chunk.size()) || is.gcount() > 0) {
+    updateContext(*m_ctx, {reinterpret_cast<const uint8_t*>(chunk.data()),
+                           static_cast<size_t>(is.gcount())});
+  }
+  m_isEmpty = false;
+  computeDigest();
 }
 
+Sha256::Sha256(Sha256&&) noexcept = default;
+
+Sha256&
+Sha256::operator=(Sha256&&) noexcept = default;
+
+Sha256::~Sha256() = default;
+
 void
 Sha256::reset()
 {
-  namespace tr = security::transform;
-
-  m_input = make_unique<tr::StepSource>();
-  m_output = make_unique<OBufferStream>();
+  if (m_ctx == nullptr) {
+    m_ctx = make_unique<security::detail::EvpMdCtx>();
+  }
+  initContext(*m_ctx);
+  m_digest = nullptr;
   m_isEmpty = true;
   m_isFinalized = false;
-
-  *m_input >> tr::digestFilter(DigestAlgorithm::SHA256) >> tr::streamSink(*m_output);
 }
 
 ConstBufferPtr
 Sha256::computeDigest()
 {
   if (!m_isFinalized) {
-    BOOST_ASSERT(m_input != nullptr);
-    m_input->end();
+    BOOST_ASSERT(m_ctx != nullptr);
+    m_digest = make_shared<Buffer>(DIGEST_SIZE);
+    finalizeContext(*m_ctx, m_digest->data());
     m_isFinalized = true;
   }
 
-  return m_output->buf();
+  return m_digest;
 }
 
 bool
@@ -119,8 +160,8 @@ Sha256::update(span<const uint8_t> buffer)
   if (m_isFinalized)
     NDN_THROW(Error("Digest has been already finalized"));
 
-  BOOST_ASSERT(m_input != nullptr);
-  m_input->write(buffer);
+  BOOST_ASSERT(m_ctx != nullptr);
+  updateContext(*m_ctx, buffer);
   m_isEmpty = false;
 }
 
@@ -134,9 +175,32 @@ Sha256::toString()
 ConstBufferPtr
 Sha256::computeDigest(span<const uint8_t> buffer)
 {
-  Sha256 sha256;
-  sha256.update(buffer);
-  return sha256.computeDigest();
+  auto digest = make_shared<Buffer>(DIGEST_SIZE);
+  auto* ctx = getThreadContext();
+  initContext(ctx);
+  updateContext(ctx, buffer);
+  finalizeContext(ctx, digest->data());
+  return digest;
+}
+
+void
+Sha256::computeDigest(span<const uint8_t> buffer, Digest& digest)
+{
+  auto* ctx = getThreadContext();
+  initContext(ctx);
+  updateContext(ctx, buffer);
+  finalizeContext(ctx, digest.data());
+}
+
+void
+Sha256::computeDigest(const InputBuffers& buffers, Digest& digest)
+{
+  auto* ctx = getThreadContext();
+  initContext(ctx);
+  for (const auto& buffer : buffers) {
+    updateContext(ctx, buffer);
+  }
+  finalizeContext(ctx, digest.data());
 }
 
 std::ostream&
@@ -24,9 +24,18 @@
 
 #include "ndn-cxx/encoding/block.hpp"
 #include "ndn-cxx/encoding/buffer-stream.hpp"
-#include "ndn-cxx/security/transform/step-source.hpp"
+#include "ndn-cxx/security/security-common.hpp"
+
+#include <array>
 
 namespace ndn {
+
+namespace security {
+namespace detail {
+class EvpMdCtx;
+} // namespace detail
+} // namespace security
+
 namespace util {
 
 /**
@@ -55,6 +64,11 @@ public:
    */
   static const size_t DIGEST_SIZE = 32;
 
+  /**
+   * @brief SHA-256 digest stored by value.
+   */
+  using Digest = std::array<uint8_t, DIGEST_SIZE>;
+
   /**
    * @brief Create an empty SHA-256 digest.
    */
@@ -66,6 +80,13 @@ public:
   explicit
   Sha256(std::istream& is);
 
+  Sha256(Sha256&&) noexcept;
+
+  Sha256&
+  operator=(Sha256&&) noexcept;
+
+  ~Sha256();
+
   /**
    * @brief Check if digest is empty.
    *
@@ -160,9 +181,29 @@ public:
   static ConstBufferPtr
   computeDigest(span<const uint8_t> buffer);
 
+  /**
+   * @brief Stateless SHA-256 digest calculation that does not allocate memory.
+   *
+   * The calculation uses an OpenSSL digest context that is reused by the calling thread.
+   * OpenSSL selects the hardware-accelerated implementation (e.g., SHA-NI or ARMv8
+   * cryptography extensions) when the CPU supports it.
+   *
+   * @param buffer input buffer
+   * @param[out] digest SHA-256 digest of @p buffer
+   */
+  static void
+  computeDigest(span<const uint8_t> buffer, Digest& digest);
+
+  /**
+   * @brief Stateless SHA-256 digest calculation over the concatenation of @p buffers.
+   * @sa computeDigest(span<const uint8_t>, Digest&)
+   */
+  static void
+  computeDigest(const InputBuffers& buffers, Digest& digest);
+
 private:
-  unique_ptr<security::transform::StepSource> m_input;
-  unique_ptr<OBufferStream> m_output;
+  unique_ptr<security::detail::EvpMdCtx> m_ctx;
+  shared_ptr<Buffer> m_digest;
   bool m_isEmpty;
   bool m_isFinalized;
 };
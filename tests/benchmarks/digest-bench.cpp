@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Digest Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/security/transform/buffer-source.hpp"
+#include "ndn-cxx/security/transform/digest-filter.hpp"
+#include "ndn-cxx/security/transform/stream-sink.hpp"
+#include "ndn-cxx/util/sha256.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace util {
+namespace tests {
+
+using namespace ndn::tests;
+
+// Benchmark of SHA-256 digest calculation over packet-sized buffers.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(Sha256Digest)
+{
+  const size_t N_ITERATIONS = 1000000;
+
+  for (size_t size : {64, 512, 1500, 8800}) {
+    std::vector<uint8_t> input(size, 0xA5);
+    size_t nMatches = 0;
+
+    auto d1 = timedExecute([&] {
+      namespace tr = security::transform;
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        OBufferStream os;
+        tr::bufferSource(input) >> tr::digestFilter(DigestAlgorithm::SHA256) >> tr::streamSink(os);
+        nMatches += os.buf()->front() != 0;
+      }
+    });
+
+    auto d2 = timedExecute([&] {
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        nMatches += Sha256::computeDigest(input)->front() != 0;
+      }
+    });
+
+    auto d3 = timedExecute([&] {
+      Sha256::Digest digest;
+      for (size_t i = 0; i < N_ITERATIONS; ++i) {
+        Sha256::computeDigest(input, digest);
+        nMatches += digest.front() != 0;
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nMatches % N_ITERATIONS, 0);
+    std::cout << "size=" << size
+              << " transform=" << d1 / N_ITERATIONS
+              << " buffer=" << d2 / N_ITERATIONS
+              << " in-place=" << d3 / N_ITERATIONS << std::endl;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DataFullName)
+{
+  const size_t N_PACKETS = 1000000;
+
+  Data data(Name("/benchmark/digest/full-name").appendVersion());
+  data.setContent(std::vector<uint8_t>(1024, 0x5A));
+  data.setSignatureInfo(SignatureInfo(tlv::DigestSha256));
+  data.setSignatureValue(std::vector<uint8_t>(32));
+  Block wire = data.wireEncode();
+
+  size_t nComponents = 0;
+  auto d = timedExecute([&] {
+    for (size_t i = 0; i < N_PACKETS; ++i) {
+      Data packet(wire);
+      nComponents += packet.getFullName().size();
+    }
+  });
+
+  BOOST_CHECK_EQUAL(nComponents, N_PACKETS * (data.getName().size() + 1));
+  std::cout << "getFullName " << d / N_PACKETS << std::endl;
+}
+
+} // namespace tests
+} // namespace util
+} // namespace ndn
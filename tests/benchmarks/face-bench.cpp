@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Face Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/util/dummy-client-face.hpp"
+#include "tests/test-common.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/asio/io_service.hpp>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+// Measures how the cost of matching incoming Data against the pending Interest table
+// scales with the number of outstanding Interests.
+BOOST_AUTO_TEST_CASE(SatisfyPendingInterests)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+
+  for (size_t nInterests : {1000, 10000, 50000}) {
+    boost::asio::io_service io;
+    util::DummyClientFace face(io, keyChain, {false, false});
+
+    std::vector<shared_ptr<Data>> data;
+    data.reserve(nInterests);
+    size_t nSatisfied = 0;
+    for (size_t i = 0; i < nInterests; ++i) {
+      Name name("/bench/object");
+      name.appendNumber(i % 100).appendSegment(i);
+      // one in ten Interests uses CanBePrefix
+      bool canBePrefix = i % 10 == 0;
+      face.expressInterest(*makeInterest(canBePrefix ? name.getPrefix(-1) : name, canBePrefix, 1_h),
+                           [&] (auto&&...) { ++nSatisfied; }, nullptr, nullptr);
+      data.push_back(makeData(name));
+    }
+    io.poll();
+
+    auto d = timedExecute([&] {
+      for (const auto& d : data) {
+        face.receive(*d);
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nSatisfied, nInterests);
+    std::cout << "satisfy " << nInterests << " pending Interests: " << d
+              << " (" << d / nInterests << " per Data)" << std::endl;
+  }
+}
+
+// Measures how the cost of dispatching an incoming Interest to InterestFilters
+// scales with the number of registered filters.
+BOOST_AUTO_TEST_CASE(DispatchInterest)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+
+  for (size_t nFilters : {100, 1000, 10000}) {
+    boost::asio::io_service io;
+    util::DummyClientFace face(io, keyChain, {false, false});
+
+    size_t nDispatched = 0;
+    for (size_t i = 0; i < nFilters; ++i) {
+      Name prefix("/bench/user");
+      prefix.appendNumber(i);
+      // one in ten filters has a regular expression
+      InterestFilter filter = i % 10 == 0 ? InterestFilter(prefix, "<data><>*") : InterestFilter(prefix);
+      face.setInterestFilter(filter, [&] (auto&&...) { ++nDispatched; });
+    }
+    io.poll();
+
+    const size_t nInterests = 100000;
+    std::vector<shared_ptr<Interest>> interests;
+    interests.reserve(nInterests);
+    for (size_t i = 0; i < nInterests; ++i) {
+      Name name("/bench/user");
+      name.appendNumber(i % nFilters).append("data").appendSegment(i);
+      interests.push_back(makeInterest(name, false, 1_h));
+      interests.back()->wireEncode();
+    }
+
+    auto d = timedExecute([&] {
+      for (const auto& interest : interests) {
+        face.receive(*interest);
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nDispatched, nInterests);
+    std::cout << "dispatch " << nInterests << " Interests to " << nFilters << " InterestFilters: "
+              << d << " (" << d / nInterests << " per Interest)" << std::endl;
+  }
+}
+
+} // namespace tests
+} // namespace ndn
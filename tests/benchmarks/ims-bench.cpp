@@ -0,0 +1,94 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx InMemoryStorage Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/ims/in-memory-storage-persistent.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+// Benchmark of InMemoryStorage::find on a large persistent storage, where each "directory"
+// holds many versions of the same object.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+// Each entry takes roughly 1 KiB; raise N_ENTRIES to 10M on machines with enough memory.
+BOOST_AUTO_TEST_CASE(Find)
+{
+  const size_t N_ENTRIES = 1000000;
+  const size_t N_DIRS = 1000;
+  const size_t N_LOOKUPS = 1000000;
+
+  InMemoryStoragePersistent ims;
+  auto makeName = [] (size_t i) {
+    return Name("/benchmark/ims").appendNumber(i % N_DIRS).appendVersion(i / N_DIRS);
+  };
+
+  auto dInsert = timedExecute([&] {
+    for (size_t i = 0; i < N_ENTRIES; ++i) {
+      Data data(makeName(i));
+      data.setSignatureInfo(SignatureInfo(tlv::DigestSha256));
+      data.setSignatureValue(std::vector<uint8_t>(32));
+      data.wireEncode();
+      ims.insert(data);
+    }
+  });
+  BOOST_CHECK_EQUAL(ims.size(), N_ENTRIES);
+  std::cout << "insert " << dInsert / N_ENTRIES << std::endl;
+
+  size_t nFound = 0;
+  auto dExact = timedExecute([&] {
+    for (size_t i = 0; i < N_LOOKUPS; ++i) {
+      Interest interest(makeName(i * 7919 % N_ENTRIES));
+      nFound += ims.find(interest) != nullptr;
+    }
+  });
+  BOOST_CHECK_EQUAL(nFound, N_LOOKUPS);
+  std::cout << "exact hit " << dExact / N_LOOKUPS << std::endl;
+
+  // exact-match Interest for a directory name: every version under it is a non-matching candidate
+  nFound = 0;
+  auto dMiss = timedExecute([&] {
+    for (size_t i = 0; i < N_LOOKUPS; ++i) {
+      Interest interest(Name("/benchmark/ims").appendNumber(i % N_DIRS));
+      nFound += ims.find(interest) != nullptr;
+    }
+  });
+  BOOST_CHECK_EQUAL(nFound, 0);
+  std::cout << "exact miss " << dMiss / N_LOOKUPS << std::endl;
+
+  nFound = 0;
+  auto dPrefix = timedExecute([&] {
+    for (size_t i = 0; i < N_LOOKUPS; ++i) {
+      Interest interest(Name("/benchmark/ims").appendNumber(i % N_DIRS));
+      interest.setCanBePrefix(true);
+      nFound += ims.find(interest) != nullptr;
+    }
+  });
+  BOOST_CHECK_EQUAL(nFound, N_LOOKUPS);
+  std::cout << "prefix " << dPrefix / N_LOOKUPS << std::endl;
+}
+
+} // namespace tests
+} // namespace ndn
@@ -27,6 +27,7 @@
 
 #include <boost/asio/io_service.hpp>
 #include <iostream>
+#include <vector>
 
 namespace ndn {
 namespace scheduler {
@@ -34,56 +35,90 @@ namespace tests {
 
 using namespace ndn::tests;
 
+static const std::vector<std::pair<Scheduler::QueueType, std::string>> QUEUE_TYPES{
+  {Scheduler::QueueType::ORDERED, "ordered"},
+  {Scheduler::QueueType::TIMING_WHEEL, "timing-wheel"},
+};
+
 BOOST_AUTO_TEST_CASE(ScheduleCancel)
 {
-  boost::asio::io_service io;
-  Scheduler sched(io);
+  for (const auto& queueType : QUEUE_TYPES) {
+    boost::asio::io_service io;
+    Scheduler sched(io, queueType.first);
+
+    const size_t nEvents = 1000000;
+    std::vector<EventId> eventIds(nEvents);
+
+    auto d1 = timedExecute([&] {
+      for (size_t i = 0; i < nEvents; ++i) {
+        eventIds[i] = sched.schedule(1_s, []{});
+      }
+    });
+
+    auto d2 = timedExecute([&] {
+      for (size_t i = 0; i < nEvents; ++i) {
+        eventIds[i].cancel();
+      }
+    });
+
+    std::cout << "[" << queueType.second << "] schedule " << nEvents << " events: " << d1 << std::endl;
+    std::cout << "[" << queueType.second << "] cancel " << nEvents << " events: " << d2 << std::endl;
+  }
+}
 
-  const size_t nEvents = 1000000;
-  std::vector<EventId> eventIds(nEvents);
+BOOST_AUTO_TEST_CASE(Churn)
+{
+  // Simulates a pending Interest table: each event is a timeout that is usually canceled
+  // shortly after being scheduled, while a window of other events remains pending.
+  for (const auto& queueType : QUEUE_TYPES) {
+    boost::asio::io_service io;
+    Scheduler sched(io, queueType.first);
+
+    const size_t nEvents = 2000000;
+    const size_t windowSize = 10000;
+    std::vector<EventId> window(windowSize);
+
+    auto d = timedExecute([&] {
+      for (size_t i = 0; i < nEvents; ++i) {
+        EventId& eid = window[i % windowSize];
+        eid.cancel();
+        eid = sched.schedule(time::milliseconds(1000 + i % 3000), []{});
+      }
+    });
+
+    std::cout << "[" << queueType.second << "] schedule and cancel " << nEvents << " events "
+              << "with " << windowSize << " pending: " << d << std::endl;
+  }
+}
 
-  auto d1 = timedExecute([&] {
-    for (size_t i = 0; i < nEvents; ++i) {
-      eventIds[i] = sched.schedule(1_s, []{});
-    }
-  });
+BOOST_AUTO_TEST_CASE(Execute)
+{
+  for (const auto& queueType : QUEUE_TYPES) {
+    boost::asio::io_service io;
+    Scheduler sched(io, queueType.first);
+
+    const size_t nEvents = 1000000;
+    size_t nExpired = 0;
+
+    // Events should expire at t1, but execution finishes at t2. The difference is the overhead.
+    time::steady_clock::TimePoint t1 = time::steady_clock::now() + 5_s;
+    time::steady_clock::TimePoint t2;
+    // +1ms ensures this extra event is executed last. In case the overhead is less than 1ms,
+    // it will be reported as 1ms.
+    sched.schedule(t1 - time::steady_clock::now() + 1_ms, [&] {
+      t2 = time::steady_clock::now();
+      BOOST_REQUIRE_EQUAL(nExpired, nEvents);
+    });
 
-  auto d2 = timedExecute([&] {
     for (size_t i = 0; i < nEvents; ++i) {
-      eventIds[i].cancel();
+      sched.schedule(t1 - time::steady_clock::now(), [&] { ++nExpired; });
     }
-  });
 
-  std::cout << "schedule " << nEvents << " events: " << d1 << std::endl;
-  std::cout << "cancel " << nEvents << " events: " << d2 << std::endl;
-}
+    io.run();
 
-BOOST_AUTO_TEST_CASE(Execute)
-{
-  boost::asio::io_service io;
-  Scheduler sched(io);
-
-  const size_t nEvents = 1000000;
-  size_t nExpired = 0;
-
-  // Events should expire at t1, but execution finishes at t2. The difference is the overhead.
-  time::steady_clock::TimePoint t1 = time::steady_clock::now() + 5_s;
-  time::steady_clock::TimePoint t2;
-  // +1ms ensures this extra event is executed last. In case the overhead is less than 1ms,
-  // it will be reported as 1ms.
-  sched.schedule(t1 - time::steady_clock::now() + 1_ms, [&] {
-    t2 = time::steady_clock::now();
     BOOST_REQUIRE_EQUAL(nExpired, nEvents);
-  });
-
-  for (size_t i = 0; i < nEvents; ++i) {
-    sched.schedule(t1 - time::steady_clock::now(), [&] { ++nExpired; });
+    std::cout << "[" << queueType.second << "] execute " << nEvents << " events: " << (t2 - t1) << std::endl;
   }
-
-  io.run();
-
-  BOOST_REQUIRE_EQUAL(nExpired, nEvents);
-  std::cout << "execute " << nEvents << " events: " << (t2 - t1) << std::endl;
 }
 
 } // namespace tests
@@ -0,0 +1,154 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/compact-name.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <boost/lexical_cast.hpp>
+#include <unordered_set>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(TestCompactName)
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  CompactName cn;
+  BOOST_CHECK(cn.empty());
+  BOOST_CHECK_EQUAL(cn.size(), 0);
+  BOOST_CHECK(cn.isInline());
+  BOOST_CHECK_EQUAL(cn.toName(), Name());
+  BOOST_CHECK_EQUAL(cn.wireEncode(), "0700"_block);
+  BOOST_CHECK_EQUAL(cn, CompactName(Name()));
+}
+
+BOOST_AUTO_TEST_CASE(Conversion)
+{
+  Name name("/Emid/25042=P3/.../..../%1C%9F/"
+            "sha256digest=0415e3624a151850ac686c84f155f29808c0dd73819aa4a4c20be73a4d8a874c");
+  CompactName cn(name);
+  BOOST_CHECK_EQUAL(cn.size(), 6);
+  BOOST_CHECK(cn.isInline());
+  for (size_t i = 0; i < name.size(); ++i) {
+    BOOST_CHECK_EQUAL(cn.get(i), name[i]);
+  }
+  BOOST_CHECK_EQUAL(cn.toName(), name);
+  BOOST_CHECK_EQUAL(cn.wireEncode(), name.wireEncode());
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(cn), name.toUri());
+
+  Name longName("/long");
+  longName.append(std::string(200, 'x'));
+  CompactName longCn(longName);
+  BOOST_CHECK(!longCn.isInline());
+  BOOST_CHECK_EQUAL(longCn.toName(), longName);
+}
+
+BOOST_AUTO_TEST_CASE(CopyMove)
+{
+  Name shortName("/A/B");
+  Name longName("/A");
+  longName.append(std::string(200, 'x'));
+
+  for (const Name& name : {shortName, longName}) {
+    CompactName cn1(name);
+    CompactName cn2(cn1);
+    BOOST_CHECK_EQUAL(cn2.toName(), name);
+    CompactName cn3(std::move(cn2));
+    BOOST_CHECK_EQUAL(cn3.toName(), name);
+
+    CompactName cn4(Name("/other"));
+    cn4 = cn1;
+    BOOST_CHECK_EQUAL(cn4.toName(), name);
+    CompactName cn5(longName);
+    cn5 = std::move(cn4);
+    BOOST_CHECK_EQUAL(cn5.toName(), name);
+    cn5 = CompactName(longName);
+    cn5 = cn1;
+    BOOST_CHECK_EQUAL(cn5.toName(), name);
+
+    const CompactName& self = cn1;
+    cn1 = self;
+    BOOST_CHECK_EQUAL(cn1.toName(), name);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(IsPrefixOf)
+{
+  BOOST_CHECK(CompactName(Name("/")).isPrefixOf(CompactName(Name("/A"))));
+  BOOST_CHECK(CompactName(Name("/A")).isPrefixOf(CompactName(Name("/A"))));
+  BOOST_CHECK(CompactName(Name("/A")).isPrefixOf(CompactName(Name("/A/B"))));
+  BOOST_CHECK(!CompactName(Name("/A/B")).isPrefixOf(CompactName(Name("/A"))));
+  BOOST_CHECK(!CompactName(Name("/A")).isPrefixOf(CompactName(Name("/AA/B"))));
+  BOOST_CHECK(!CompactName(Name("/B")).isPrefixOf(CompactName(Name("/A/B"))));
+}
+
+BOOST_AUTO_TEST_CASE(Compare)
+{
+  std::vector<Name> names = {
+    Name("/"),
+    Name("/sha256digest=0000000000000000000000000000000000000000000000000000000000000000"),
+    Name("/sha256digest=FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"),
+    Name("/3=..."),
+    Name("/3=D"),
+    Name("/3=AA"),
+    Name("/..."),
+    Name("/D"),
+    Name("/D/3=D"),
+    Name("/D/D"),
+    Name("/D/AA"),
+    Name("/D/21426=..."),
+    Name("/F"),
+    Name("/AA"),
+  };
+
+  for (size_t i = 0; i < names.size(); ++i) {
+    for (size_t j = 0; j < names.size(); ++j) {
+      CompactName lhs(names[i]);
+      CompactName rhs(names[j]);
+      BOOST_TEST_CONTEXT("lhs=" << names[i] << " rhs=" << names[j]) {
+        BOOST_CHECK_EQUAL(lhs == rhs, i == j);
+        BOOST_CHECK_EQUAL(lhs != rhs, i != j);
+        BOOST_CHECK_EQUAL(lhs < rhs, i < j);
+        BOOST_CHECK_EQUAL(lhs <= rhs, i <= j);
+        BOOST_CHECK_EQUAL(lhs > rhs, i > j);
+        BOOST_CHECK_EQUAL(lhs >= rhs, i >= j);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Hash)
+{
+  std::unordered_set<CompactName> names;
+  names.insert(CompactName(Name("/A/B")));
+  names.insert(CompactName(Name("/A/B")));
+  names.insert(CompactName(Name("/A")));
+  BOOST_CHECK_EQUAL(names.size(), 2);
+  BOOST_CHECK_EQUAL(names.count(CompactName(Name("/A/B"))), 1);
+  BOOST_CHECK_EQUAL(names.count(CompactName(Name("/A/C"))), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCompactName
+
+} // namespace tests
+} // namespace ndn
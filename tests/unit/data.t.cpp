@@ -207,6 +207,24 @@ BOOST_FIXTURE_TEST_CASE(Full, DataSigningKeyFixture)
   BOOST_TEST(d.wireEncode() == DATA1, boost::test_tools::per_element());
 }
 
+BOOST_AUTO_TEST_CASE(WithSignature)
+{
+  Data d("/A");
+  d.setSignatureInfo(SignatureInfo(tlv::DigestSha256));
+
+  EncodingBuffer encoder; // default-sized buffer is much larger than the packet
+  d.wireEncode(encoder, true);
+  const uint8_t sig[] = {0xAA, 0xBB};
+  const Block& wire = d.wireEncode(encoder, make_span(sig));
+
+  BOOST_CHECK_EQUAL(wire, "0610 0703080141 1400 16031B0100 1702AABB"_block);
+  // the unused part of the encoder's buffer has been released
+  BOOST_CHECK_EQUAL(wire.getBuffer()->size(), wire.size());
+  // the fields refer to the final encoding
+  BOOST_CHECK_EQUAL(d.getSignatureValue().getBuffer(), wire.getBuffer());
+  BOOST_CHECK_EQUAL(d.getSignatureValue(), "1702AABB"_block);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Encode
 
 class DecodeFixture
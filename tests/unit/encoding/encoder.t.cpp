@@ -152,6 +152,25 @@ BOOST_AUTO_TEST_CASE(Reserve)
   BOOST_CHECK_GT(e.capacity(), 2000);
 }
 
+BOOST_AUTO_TEST_CASE(ShrinkToFit)
+{
+  Encoder e;
+  e.prependBytes({0x01, 0x02});
+  e.appendBytes({0x03});
+  e.shrinkToFit();
+  BOOST_CHECK_EQUAL(e.capacity(), 3);
+  BOOST_CHECK_EQUAL(e.size(), 3);
+
+  e.shrinkToFit(2, 1);
+  BOOST_CHECK_EQUAL(e.capacity(), 6);
+  e.prependBytes({0x00});
+  e.appendBytes({0x04});
+  BOOST_CHECK_EQUAL(e.capacity(), 6);
+
+  const uint8_t expected[] = {0x00, 0x01, 0x02, 0x03, 0x04};
+  BOOST_CHECK_EQUAL_COLLECTIONS(e.begin(), e.end(), std::begin(expected), std::end(expected));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestEncoder
 BOOST_AUTO_TEST_SUITE_END() // Encoding
 
@@ -32,6 +32,8 @@
 
 #include <boost/logic/tribool.hpp>
 
+#include <thread>
+
 namespace ndn {
 namespace tests {
 
@@ -516,6 +518,104 @@ BOOST_AUTO_TEST_CASE(PutMultipleNackLoopback)
 
 BOOST_AUTO_TEST_SUITE_END() // Producer
 
+BOOST_AUTO_TEST_SUITE(Submission)
+
+BOOST_AUTO_TEST_CASE(FromThreads)
+{
+  face.enableSubmissionQueue(1024);
+
+  const size_t nThreads = 4;
+  const size_t nPerThread = 100;
+  size_t nData = 0;
+  std::atomic<size_t> nAccepted{0}; // Boost.Test assertions are not thread-safe
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < nThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (size_t i = 0; i < nPerThread; ++i) {
+        Name name("/A");
+        name.appendNumber(t).appendNumber(i);
+        nAccepted += face.submitInterest(Interest(name),
+                                         [&] (const Interest&, const Data&) { ++nData; },
+                                         bind([] { BOOST_FAIL("Unexpected Nack"); }),
+                                         nullptr);
+        nAccepted += face.submitData(*makeData(Name("/D").append(name)));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  BOOST_CHECK_EQUAL(nAccepted, 2 * nThreads * nPerThread);
+  BOOST_CHECK_EQUAL(face.getSubmissionQueueDepth(), 2 * nThreads * nPerThread);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 0);
+
+  advanceClocks(1_ms, 10);
+  BOOST_CHECK_EQUAL(face.getSubmissionQueueDepth(), 0);
+  BOOST_CHECK_EQUAL(face.getNRejectedSubmissions(), 0);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), nThreads * nPerThread);
+  BOOST_CHECK_EQUAL(face.sentData.size(), nThreads * nPerThread);
+
+  // callbacks are invoked on the io_service thread
+  face.receive(*makeData("/A/%00/%01"));
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(nData, 1);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), nThreads * nPerThread - 1);
+}
+
+BOOST_AUTO_TEST_CASE(BackPressure)
+{
+  BOOST_CHECK_EQUAL(face.submitData(*makeData("/not-enabled")), false);
+  BOOST_CHECK_EQUAL(face.getNRejectedSubmissions(), 1);
+
+  face.enableSubmissionQueue(4);
+  for (int i = 0; i < 4; ++i) {
+    BOOST_CHECK_EQUAL(face.submitData(*makeData(Name("/D").appendNumber(i))), true);
+  }
+  BOOST_CHECK_EQUAL(face.submitData(*makeData("/D/full")), false);
+  BOOST_CHECK_EQUAL(face.getNRejectedSubmissions(), 2);
+  BOOST_CHECK_EQUAL(face.getSubmissionQueueDepth(), 4);
+
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(face.sentData.size(), 4);
+  BOOST_CHECK_EQUAL(face.submitData(*makeData("/D/after")), true);
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(face.sentData.size(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(Oversized)
+{
+  face.enableSubmissionQueue(16);
+
+  auto bigData = makeData("/D/big");
+  bigData->setContent(std::vector<uint8_t>(MAX_NDN_PACKET_SIZE));
+  Interest bigInterest("/A/big");
+  bigInterest.setApplicationParameters(std::vector<uint8_t>(MAX_NDN_PACKET_SIZE));
+
+  BOOST_CHECK_EQUAL(face.submitInterest(bigInterest,
+                                        bind([] { BOOST_FAIL("Unexpected Data"); }),
+                                        bind([] { BOOST_FAIL("Unexpected Nack"); }),
+                                        bind([] { BOOST_FAIL("Unexpected timeout"); })),
+                    true);
+  BOOST_CHECK_EQUAL(face.submitData(*bigData), true);
+  for (int i = 0; i < 4; ++i) {
+    BOOST_CHECK_EQUAL(face.submitInterest(Interest(Name("/A").appendNumber(i)), nullptr, nullptr, nullptr),
+                      true);
+    BOOST_CHECK_EQUAL(face.submitData(*makeData(Name("/D").appendNumber(i))), true);
+  }
+
+  BOOST_CHECK_NO_THROW(advanceClocks(1_ms));
+  BOOST_CHECK_EQUAL(face.getSubmissionQueueDepth(), 0);
+  BOOST_CHECK_EQUAL(face.getNRejectedSubmissions(), 2);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 4);
+  BOOST_CHECK_EQUAL(face.sentData.size(), 4);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 4);
+
+  // the oversized Interest does not time out later
+  advanceClocks(1_s, 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Submission
+
 BOOST_AUTO_TEST_SUITE(RegisterPrefix)
 
 BOOST_FIXTURE_TEST_CASE(Failure, FaceFixture<NoPrefixRegReply>)
@@ -129,6 +129,26 @@ BOOST_AUTO_TEST_CASE(UsedTimeQueue2)
   BOOST_CHECK_EQUAL(found3->getName(), name3);
 }
 
+BOOST_AUTO_TEST_CASE(ByteLimit)
+{
+  InMemoryStorageLru ims;
+
+  shared_ptr<Data> data1 = makeData("/insert/1");
+  shared_ptr<Data> data2 = makeData("/insert/2");
+  shared_ptr<Data> data3 = makeData("/insert/3");
+  ims.insert(*data1);
+  ims.insert(*data2);
+  ims.find(*makeInterest(data1->getName()));
+
+  ims.setByteLimit(ims.getNBytes());
+  ims.insert(*data3);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+
+  BOOST_CHECK(ims.find(*makeInterest(data2->getName())) == nullptr);
+  BOOST_CHECK(ims.find(*makeInterest(data1->getName())) != nullptr);
+  BOOST_CHECK(ims.find(*makeInterest(data3->getName())) != nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorageLru
 BOOST_AUTO_TEST_SUITE_END() // Ims
 
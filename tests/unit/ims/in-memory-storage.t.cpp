@@ -440,6 +440,66 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(InsertAndEvict, T, InMemoryStoragesLimited)
   BOOST_CHECK(found == nullptr);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(ByteLimit, T, InMemoryStoragesLimited)
+{
+  T ims;
+  BOOST_CHECK_EQUAL(ims.getByteLimit(), std::numeric_limits<size_t>::max());
+
+  auto data1 = makeData("/byte/1");
+  auto data2 = makeData("/byte/2");
+  auto data3 = makeData("/byte/3");
+  size_t dataSize = data1->wireEncode().size();
+  BOOST_REQUIRE_EQUAL(data2->wireEncode().size(), dataSize);
+  BOOST_REQUIRE_EQUAL(data3->wireEncode().size(), dataSize);
+
+  ims.setByteLimit(2 * dataSize);
+  ims.insert(*data1);
+  ims.insert(*data2);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK_EQUAL(ims.getNBytes(), 2 * dataSize);
+
+  // the oldest, least recently and least frequently used packet is evicted to make room
+  ims.insert(*data3);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK_EQUAL(ims.getNBytes(), 2 * dataSize);
+  BOOST_CHECK(ims.find("/byte/1") == nullptr);
+  BOOST_CHECK(ims.find("/byte/3") != nullptr);
+
+  // a packet larger than the limit is not inserted
+  auto bigData = makeData("/byte/big");
+  bigData->setContent(std::vector<uint8_t>(2 * dataSize));
+  signData(bigData);
+  ims.insert(*bigData);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK(ims.find("/byte/big") == nullptr);
+
+  ims.setByteLimit(dataSize);
+  BOOST_CHECK_EQUAL(ims.size(), 1);
+  BOOST_CHECK_EQUAL(ims.getNBytes(), dataSize);
+
+  ims.erase("/byte");
+  BOOST_CHECK_EQUAL(ims.size(), 0);
+  BOOST_CHECK_EQUAL(ims.getNBytes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ByteLimitPersistent)
+{
+  InMemoryStoragePersistent ims;
+
+  auto data1 = makeData("/byte/1");
+  size_t dataSize = data1->wireEncode().size();
+  ims.insert(*data1);
+  BOOST_CHECK_EQUAL(ims.getNBytes(), dataSize);
+
+  // persistent storage never evicts, so a new packet is dropped once the limit is reached
+  ims.setByteLimit(dataSize);
+  ims.insert(*makeData("/byte/2"));
+  BOOST_CHECK_EQUAL(ims.size(), 1);
+  BOOST_CHECK(ims.find("/byte/1") != nullptr);
+
+  BOOST_CHECK_THROW(ims.setByteLimit(dataSize - 1), InMemoryStorage::Error);
+}
+
 // Find function is implemented at the base case, so it's sufficient to test for one derived class.
 class FindFixture : public IoFixture
 {
@@ -517,6 +577,48 @@ BOOST_AUTO_TEST_CASE(ExactName_CanBePrefix)
   BOOST_CHECK_EQUAL(find(), 2);
 }
 
+BOOST_AUTO_TEST_CASE(ExactName_MultipleDigests)
+{
+  Name n1 = insert(1, "/A");
+  Name n2 = insert(2, "/A");
+  insert(3, "/A/B");
+  uint32_t lowest = n1 < n2 ? 1 : 2;
+
+  startInterest("/A");
+  BOOST_CHECK_EQUAL(find(), lowest);
+
+  startInterest("/A")
+    .setCanBePrefix(true);
+  BOOST_CHECK_EQUAL(find(), lowest);
+
+  BOOST_CHECK_EQUAL(m_ims.find(Name("/A"))->getFullName(), std::min(n1, n2));
+
+  m_ims.erase(std::min(n1, n2), false);
+  startInterest("/A");
+  BOOST_CHECK_EQUAL(find(), 3 - lowest);
+
+  m_ims.erase("/A");
+  BOOST_CHECK_EQUAL(m_ims.size(), 0);
+  BOOST_CHECK_EQUAL(find(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ExactName_ManyChildren)
+{
+  for (uint32_t i = 1; i <= 100; ++i) {
+    insert(i, Name("/A").appendVersion(i));
+  }
+
+  startInterest("/A");
+  BOOST_CHECK_EQUAL(find(), 0);
+
+  startInterest(Name("/A").appendVersion(42));
+  BOOST_CHECK_EQUAL(find(), 42);
+
+  insert(101, "/A");
+  startInterest("/A");
+  BOOST_CHECK_EQUAL(find(), 101);
+}
+
 BOOST_AUTO_TEST_CASE(FullName)
 {
   Name n1 = insert(1, "/A");
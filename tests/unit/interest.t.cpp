@@ -623,6 +623,38 @@ BOOST_AUTO_TEST_CASE(BadParametersDigest)
   BOOST_CHECK_EQUAL(i.isParametersDigestValid(), false);
 }
 
+BOOST_AUTO_TEST_CASE(SkipParametersDigestCheck)
+{
+  // digest mismatch
+  Block b1("052B 0725(080149 02200000000000000000000000000000000000000000000000000000000000000000) "
+           "2402CAFE"_block);
+  // correct digest
+  Interest good("/I");
+  good.setApplicationParameters("2402CAFE"_block);
+  Block b2 = good.wireEncode();
+
+  BOOST_CHECK_THROW(Interest(b1, true), tlv::Error);
+  BOOST_CHECK_NO_THROW(Interest(b1, false));
+  BOOST_CHECK_EQUAL(Interest(b1, false).isParametersDigestValid(), false);
+
+  // per-decode setting takes precedence over the global one
+  DisableAutoCheckParametersDigest disabler;
+  BOOST_CHECK_THROW(i.wireDecode(b1, true), tlv::Error);
+
+  i.wireDecode(b1, false);
+  BOOST_CHECK_EQUAL(i.isParametersDigestValid(), false);
+  BOOST_CHECK_EQUAL(i.isParametersDigestValid(), false); // cached
+
+  i.wireDecode(b2, false);
+  BOOST_CHECK_EQUAL(i.isParametersDigestValid(), true);
+
+  i.wireDecode(b1, false);
+  BOOST_CHECK_EQUAL(i.isParametersDigestValid(), false); // cache reset by wireDecode
+  i.setApplicationParameters("2402CAFE"_block); // recomputes the digest
+  BOOST_CHECK_EQUAL(i.isParametersDigestValid(), true);
+  BOOST_CHECK_EQUAL(i.getName(), good.getName());
+}
+
 BOOST_AUTO_TEST_CASE(UnrecognizedNonCriticalElementBeforeName)
 {
   BOOST_CHECK_EXCEPTION(i.wireDecode("0507 FC00 0703080149"_block), tlv::Error,
@@ -102,6 +102,25 @@ BOOST_AUTO_TEST_CASE(EncodeFragment)
                                 wire.begin(), wire.end());
 }
 
+BOOST_AUTO_TEST_CASE(EncodeWithFragment)
+{
+  static const uint8_t expectedBlock[] = {
+    0x64, 0x0e, // LpPacket
+          0x51, 0x08, // Sequence
+                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe8,
+          0x50, 0x02, // Fragment
+                0x03, 0xe8,
+  };
+  static const uint8_t fragment[] = {0x03, 0xe8};
+
+  Packet packet;
+  packet.add<SequenceField>(1000);
+  Block wire = packet.wireEncode(fragment);
+  BOOST_CHECK_EQUAL_COLLECTIONS(expectedBlock, expectedBlock + sizeof(expectedBlock),
+                                wire.begin(), wire.end());
+  BOOST_CHECK_EQUAL(packet.count<FragmentField>(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(EncodeSubTlv)
 {
   static const uint8_t expectedBlock[] = {
@@ -403,9 +422,23 @@ BOOST_AUTO_TEST_CASE(DecodeBareNetworkLayerPacket)
   packet.wireDecode(wire);
   BOOST_CHECK_EQUAL(1, packet.count<FragmentField>());
 
+  // the fragment refers to the decoded buffer rather than a copy
+  auto frag = packet.get<FragmentField>();
+  BOOST_CHECK(frag.first == wire.begin());
+  BOOST_CHECK(frag.second == wire.end());
+
   Block encoded = packet.wireEncode();
   BOOST_CHECK_EQUAL_COLLECTIONS(inputBlock, inputBlock + sizeof(inputBlock),
                                 encoded.begin(), encoded.end());
+
+  // adding a header yields an LpPacket that wraps the network packet
+  packet.add<SequenceField>(1000);
+  encoded = packet.wireEncode();
+  BOOST_CHECK_EQUAL(encoded.type(), tlv::LpPacket);
+  Packet decoded(encoded);
+  BOOST_CHECK_EQUAL(decoded.get<SequenceField>(), 1000);
+  frag = decoded.get<FragmentField>();
+  BOOST_CHECK_EQUAL_COLLECTIONS(inputBlock, inputBlock + sizeof(inputBlock), frag.first, frag.second);
 }
 
 BOOST_AUTO_TEST_CASE(DecodeSeqNum)
@@ -536,6 +536,36 @@ BOOST_AUTO_TEST_CASE(UnorderedMap)
   BOOST_CHECK_EQUAL(map[name3], 3);
 }
 
+BOOST_AUTO_TEST_CASE(Hash)
+{
+  Name name("/A/B/C");
+  BOOST_CHECK_EQUAL(name.getHash(), std::hash<Name>{}(name));
+  BOOST_CHECK_EQUAL(name.getHash(), Name("/A/B/C").getHash());
+  BOOST_CHECK_EQUAL(name.getHash(), Name(name.wireEncode()).getHash());
+  BOOST_CHECK_NE(name.getHash(), Name("/A/B/D").getHash());
+  BOOST_CHECK_NE(name.getHash(), Name("/A/B/8=C/C").getHash());
+  BOOST_CHECK_NE(name.getHash(), Name("/A/B/32=C").getHash());
+
+  std::vector<size_t> prefixHashes = name.getPrefixHashes();
+  BOOST_REQUIRE_EQUAL(prefixHashes.size(), name.size() + 1);
+  for (size_t i = 0; i <= name.size(); ++i) {
+    BOOST_CHECK_EQUAL(prefixHashes[i], name.getPrefix(i).getHash());
+  }
+
+  // the cached hash value is invalidated by modifiers
+  size_t oldHash = name.getHash();
+  name.append("D");
+  BOOST_CHECK_EQUAL(name.getHash(), Name("/A/B/C/D").getHash());
+  name.set(-1, Component("E"));
+  BOOST_CHECK_EQUAL(name.getHash(), Name("/A/B/C/E").getHash());
+  name.erase(-1);
+  BOOST_CHECK_EQUAL(name.getHash(), oldHash);
+  name.wireDecode(Name("/X").wireEncode());
+  BOOST_CHECK_EQUAL(name.getHash(), Name("/X").getHash());
+  name.clear();
+  BOOST_CHECK_EQUAL(name.getHash(), Name().getHash());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestName
 
 } // namespace tests
@@ -174,6 +174,27 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ValidateSuccessWithBundle, T, SuccessWithBundle
   }
 }
 
+BOOST_FIXTURE_TEST_CASE(CoalesceBundleInterests, CertificateBundleFetcherFixture<BundleWithFinalBlockId>)
+{
+  // segments of the same object share a bundle
+  Data seg0(Name(data.getName()).appendSegment(0));
+  Data seg1(Name(data.getName()).appendSegment(1));
+  m_keyChain.sign(seg0, signingByIdentity(subSubIdentity));
+  m_keyChain.sign(seg1, signingByIdentity(subSubIdentity));
+
+  size_t nSuccesses = 0;
+  for (const auto& segment : {seg0, seg1}) {
+    validator.validate(segment,
+                       [&] (const Data&) { ++nSuccesses; },
+                       [] (const Data&, const ValidationError&) {});
+  }
+  mockNetworkOperations();
+
+  BOOST_CHECK_EQUAL(nSuccesses, 2);
+  // one Interest per bundle segment, shared by both validations
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+}
+
 using SuccessWithoutBundle = boost::mpl::vector<Nack, Timeout>;
 
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ValidateSuccessWithoutBundle, T, SuccessWithoutBundle,
@@ -88,6 +88,19 @@ BOOST_AUTO_TEST_CASE(RemovalTime)
   BOOST_CHECK(certCache.find(cert.getName()) == nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(GetRemovalTime)
+{
+  BOOST_CHECK(certCache.getRemovalTime(cert.getName()) == nullopt);
+
+  auto now = time::system_clock::now();
+  certCache.insert(cert);
+  BOOST_CHECK(certCache.getRemovalTime(cert.getName()) == now + 10_s);
+  BOOST_CHECK(certCache.getRemovalTime(cert.getKeyName()) == nullopt); // exact name only
+
+  advanceClocks(11_s, 1);
+  BOOST_CHECK(certCache.getRemovalTime(cert.getName()) == nullopt);
+}
+
 BOOST_AUTO_TEST_CASE(FindByInterest)
 {
   BOOST_CHECK_NO_THROW(certCache.insert(cert));
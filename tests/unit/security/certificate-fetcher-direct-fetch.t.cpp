@@ -237,6 +237,26 @@ BOOST_FIXTURE_TEST_CASE(ValidateSuccessInterest, CertificateFetcherDirectFetchFi
   }
 }
 
+BOOST_FIXTURE_TEST_CASE(CoalesceSuccess, CertificateFetcherDirectFetchFixture<Cert>)
+{
+  size_t nSuccesses = 0;
+  this->validator.validate(this->data,
+                           [&] (const Data&) { ++nSuccesses; },
+                           [] (const Data&, const ValidationError&) {});
+  this->validator.validate(this->interest,
+                           [&] (const Interest&) { ++nSuccesses; },
+                           [] (const Interest&, const ValidationError&) {});
+  this->mockNetworkOperations();
+
+  BOOST_CHECK_EQUAL(nSuccesses, 2);
+  // both packets are signed by the same key, so one direct and one infrastructure Interest
+  // per certificate are enough
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 4);
+  size_t nDirectInterests = std::count_if(this->face.sentInterests.begin(), this->face.sentInterests.end(),
+    [] (const Interest& sentInterest) { return sentInterest.getTag<lp::NextHopFaceIdTag>() != nullptr; });
+  BOOST_CHECK_EQUAL(nDirectInterests, 2);
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ValidateFailureInterest, T, Failures, CertificateFetcherDirectFetchFixture<T>)
 {
   VALIDATE_FAILURE(this->interest, "Should fail, as all interests either NACKed or timeout");
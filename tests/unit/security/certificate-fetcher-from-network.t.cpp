@@ -130,6 +130,70 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ValidateFailure, T, Failures, CertificateFetche
   BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 4);
 }
 
+BOOST_FIXTURE_TEST_CASE(CoalesceSuccess, CertificateFetcherFromNetworkFixture<Cert>)
+{
+  size_t nSuccesses = 0;
+  this->validator.validate(this->data,
+                           [&] (const Data&) { ++nSuccesses; },
+                           [] (const Data&, const ValidationError&) {});
+  this->validator.validate(this->interest,
+                           [&] (const Interest&) { ++nSuccesses; },
+                           [] (const Interest&, const ValidationError&) {});
+  this->mockNetworkOperations();
+
+  BOOST_CHECK_EQUAL(nSuccesses, 2);
+  // both packets are signed by the same key, so one Interest per certificate is enough
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 2);
+
+  const auto& stats = static_cast<CertificateFetcherFromNetwork&>(this->validator.getFetcher()).getStatistics();
+  BOOST_CHECK_EQUAL(stats.nInterests, 2);
+  BOOST_CHECK_EQUAL(stats.nCoalescedRequests, 2);
+  BOOST_CHECK_EQUAL(stats.nFailures, 0);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(CoalesceFailure, T, Failures, CertificateFetcherFromNetworkFixture<T>)
+{
+  auto& fetcher = static_cast<CertificateFetcherFromNetwork&>(this->validator.getFetcher());
+  BOOST_CHECK_EQUAL(fetcher.getNegativeCacheLifetime(), 10_s);
+  // outlive the clock advancement of mockNetworkOperations()
+  fetcher.setNegativeCacheLifetime(5_min);
+  BOOST_CHECK_EQUAL(fetcher.getNegativeCacheLifetime(), 5_min);
+
+  size_t nFailures = 0;
+  this->validator.validate(this->data,
+                           [] (const Data&) {},
+                           [&] (const Data&, const ValidationError&) { ++nFailures; });
+  this->validator.validate(this->interest,
+                           [] (const Interest&) {},
+                           [&] (const Interest&, const ValidationError&) { ++nFailures; });
+  this->mockNetworkOperations();
+
+  BOOST_CHECK_EQUAL(nFailures, 2);
+  // first interest + 3 retries, shared by both packets
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 4);
+  BOOST_CHECK_EQUAL(fetcher.getStatistics().nCoalescedRequests, 1);
+  BOOST_CHECK_EQUAL(fetcher.getStatistics().nFailures, 1);
+
+  // the certificate could not be retrieved recently, so it is not requested again
+  this->face.sentInterests.clear();
+  VALIDATE_FAILURE(this->data, "Should fail, as the certificate could not be retrieved recently");
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 0);
+  BOOST_CHECK_EQUAL(this->lastError.getCode(), ValidationError::Code::CANNOT_RETRIEVE_CERT);
+  BOOST_CHECK_EQUAL(fetcher.getStatistics().nNegativeCacheHits, 1);
+
+  this->advanceClocks(1_h, 2); // expire negative cache and validator caches
+
+  VALIDATE_FAILURE(this->data, "Should fail, as interests don't bring data");
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 4);
+  BOOST_CHECK_EQUAL(fetcher.getStatistics().nFailures, 2);
+
+  // negative caching can be disabled
+  fetcher.setNegativeCacheLifetime(0_ns);
+  this->face.sentInterests.clear();
+  VALIDATE_FAILURE(this->data, "Should fail, as interests don't bring data");
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 4);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCertificateFetcherFromNetwork
 BOOST_AUTO_TEST_SUITE_END() // Security
 
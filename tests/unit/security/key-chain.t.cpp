@@ -224,6 +224,60 @@ BOOST_FIXTURE_TEST_CASE(SigningWithCorruptedPibTpm, KeyChainFixture)
   BOOST_CHECK_THROW(m_keyChain.sign(data, signingByIdentity(id)), KeyChain::InvalidSigningInfoError);
 }
 
+BOOST_FIXTURE_TEST_CASE(SigningWithContext, KeyChainFixture)
+{
+  Identity id = m_keyChain.createIdentity("/test");
+  Key key = id.getDefaultKey();
+  auto params = signingByIdentity(id);
+
+  SigningContext context = m_keyChain.makeSigningContext(params);
+  BOOST_CHECK_EQUAL(context.getKeyName(), key.getName());
+  BOOST_CHECK_EQUAL(context.getSignatureInfo().getKeyLocator().getName(),
+                    key.getDefaultCertificate().getName());
+  BOOST_CHECK(context.getDigestAlgorithm() == DigestAlgorithm::SHA256);
+
+  Data data1("/foobar/1");
+  m_keyChain.sign(data1, params);
+  Data data2("/foobar/2");
+  m_keyChain.sign(data2, context);
+  BOOST_CHECK_EQUAL(data2.getSignatureInfo(), data1.getSignatureInfo());
+  BOOST_CHECK(verifySignature(data2, key));
+
+  // the private key is still needed, signing fails if it is gone
+  const_cast<Tpm&>(m_keyChain.getTpm()).deleteKey(key.getName());
+  Data data3("/foobar/3");
+  BOOST_CHECK_THROW(m_keyChain.sign(data3, context), KeyChain::InvalidSigningInfoError);
+
+  // digest signing does not need any key
+  auto sha256Context = m_keyChain.makeSigningContext(signingWithSha256());
+  m_keyChain.sign(data3, sha256Context);
+  BOOST_CHECK_EQUAL(data3.getSignatureType(), tlv::DigestSha256);
+  BOOST_CHECK(verifySignature(data3, nullopt));
+}
+
+BOOST_FIXTURE_TEST_CASE(SigningBatch, KeyChainFixture)
+{
+  Identity id = m_keyChain.createIdentity("/test", RsaKeyParams());
+  Key key = id.getDefaultKey();
+  auto context = m_keyChain.makeSigningContext(signingByIdentity(id));
+
+  std::vector<Data> packets;
+  for (int i = 0; i < 10; ++i) {
+    packets.emplace_back(Name("/test/data").appendSegment(i));
+    packets.back().setContent(make_span(reinterpret_cast<const uint8_t*>("hello"), 5));
+  }
+  m_keyChain.sign(packets, context);
+
+  for (const auto& data : packets) {
+    BOOST_CHECK(verifySignature(data, key));
+    BOOST_REQUIRE(data.hasWire());
+    const Block& wire = data.wireEncode();
+    // the buffer was sized in advance for the RSA signature and did not need to grow
+    BOOST_CHECK_LE(wire.getBuffer()->size(), wire.size() + 16);
+    BOOST_CHECK_EQUAL(data.getContent().getBuffer(), wire.getBuffer());
+  }
+}
+
 BOOST_FIXTURE_TEST_CASE(SigningWithNonExistingIdentity, KeyChainFixture)
 {
   Data data("/test/data");
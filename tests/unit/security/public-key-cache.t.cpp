@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/public-key-cache.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/key-chain-fixture.hpp"
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+namespace tests {
+
+using namespace ndn::tests;
+
+class PublicKeyCacheFixture : public KeyChainFixture
+{
+public:
+  Certificate
+  makeCert(const Name& identityName)
+  {
+    return m_keyChain.createIdentity(identityName).getDefaultKey().getDefaultCertificate();
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(Security)
+BOOST_FIXTURE_TEST_SUITE(TestPublicKeyCache, PublicKeyCacheFixture)
+
+BOOST_AUTO_TEST_CASE(HitMiss)
+{
+  PublicKeyCache cache;
+  auto cert = makeCert("/TestPublicKeyCache/A");
+
+  auto key1 = cache.find(cert);
+  BOOST_REQUIRE(key1 != nullptr);
+  BOOST_CHECK_EQUAL(key1->getKeyType(), KeyType::EC);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 0);
+  BOOST_CHECK_EQUAL(cache.getNMisses(), 1);
+
+  auto key2 = cache.find(Certificate(cert)); // a copy has the same full name
+  BOOST_CHECK_EQUAL(key2, key1);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 1);
+  BOOST_CHECK_EQUAL(cache.getNMisses(), 1);
+
+  // same name but different content must not share the entry
+  Certificate resigned(cert);
+  resigned.setFreshnessPeriod(1_h);
+  m_keyChain.sign(resigned, signingWithSha256());
+  BOOST_REQUIRE_EQUAL(resigned.getName(), cert.getName());
+  auto key3 = cache.find(resigned);
+  BOOST_REQUIRE(key3 != nullptr);
+  BOOST_CHECK_NE(key3, key1);
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+  BOOST_CHECK_EQUAL(cache.getNMisses(), 2);
+
+  cache.erase(cert.getFullName());
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Limit)
+{
+  PublicKeyCache cache(2);
+  auto certA = makeCert("/TestPublicKeyCache/A");
+  auto certB = makeCert("/TestPublicKeyCache/B");
+  auto certC = makeCert("/TestPublicKeyCache/C");
+
+  cache.find(certA);
+  cache.find(certB);
+  cache.find(certA); // A becomes most recently used
+  cache.find(certC); // evicts B
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+  BOOST_CHECK_EQUAL(cache.getNMisses(), 3);
+
+  cache.find(certA);
+  BOOST_CHECK_EQUAL(cache.getNMisses(), 3);
+  cache.find(certB);
+  BOOST_CHECK_EQUAL(cache.getNMisses(), 4);
+
+  cache.setLimit(1);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+  cache.find(certB);
+  BOOST_CHECK_EQUAL(cache.getNMisses(), 4);
+
+  cache.setLimit(0);
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  BOOST_CHECK(cache.find(certB) != nullptr);
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(BadKey)
+{
+  PublicKeyCache cache;
+  Certificate cert = makeCert("/TestPublicKeyCache/A");
+  cert.setContent(make_span(reinterpret_cast<const uint8_t*>("bad key"), 7));
+  m_keyChain.sign(cert, signingWithSha256());
+
+  BOOST_CHECK(cache.find(cert) == nullptr);
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  BOOST_CHECK_EQUAL(cache.getNMisses(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPublicKeyCache
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace tests
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
@@ -164,6 +164,32 @@ BOOST_AUTO_TEST_CASE(DynamicAnchorFromDir)
   BOOST_CHECK_EQUAL(anchorContainer.getGroup("group").size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(Version)
+{
+  auto version = anchorContainer.getVersion();
+  anchorContainer.insert("group1", Certificate(cert1));
+  BOOST_CHECK_NE(anchorContainer.getVersion(), version);
+
+  version = anchorContainer.getVersion();
+  anchorContainer.insert("group1", Certificate(cert1));
+  BOOST_CHECK_EQUAL(anchorContainer.getVersion(), version); // already present
+
+  anchorContainer.insert("group2", certPath2.string(), 1_s);
+  BOOST_CHECK_NE(anchorContainer.getVersion(), version);
+
+  version = anchorContainer.getVersion();
+  advanceClocks(1_s, 2);
+  BOOST_CHECK_EQUAL(anchorContainer.getVersion(), version); // reloaded, but unchanged
+
+  boost::filesystem::remove(certPath2);
+  advanceClocks(1_s, 2);
+  BOOST_CHECK_NE(anchorContainer.getVersion(), version); // removed on refresh
+
+  version = anchorContainer.getVersion();
+  anchorContainer.clear();
+  BOOST_CHECK_NE(anchorContainer.getVersion(), version);
+}
+
 BOOST_AUTO_TEST_CASE(FindByInterest)
 {
   anchorContainer.insert("group1", certPath1.string(), 1_s);
@@ -488,6 +488,71 @@ BOOST_FIXTURE_TEST_CASE(DigestSha256, HierarchicalValidatorFixture<ValidationPol
   VALIDATE_SUCCESS(data, "Should be accepted");
 }
 
+BOOST_FIXTURE_TEST_CASE(RuleOrder, HierarchicalValidatorFixture<ValidationPolicyConfig>)
+{
+  this->policy.load(R"CONF(
+      rule
+      {
+        id test-rule-any-prefix
+        for data
+        filter
+        {
+          type name
+          regex <Sub1>
+        }
+        checker
+        {
+          type customized
+          sig-type ecdsa-sha256
+          key-locator
+          {
+            type name
+            name /Security/ValidatorFixture
+            relation is-prefix-of
+          }
+        }
+      }
+      rule
+      {
+        id test-rule-prefix
+        for data
+        filter
+        {
+          type name
+          name /Security/ValidatorFixture
+          relation is-prefix-of
+        }
+        checker
+        {
+          type customized
+          sig-type sha256
+        }
+      }
+    )CONF", "test-config");
+
+  // the first rule has no name prefix, but it still takes precedence over the second rule
+  Data data1("/Security/ValidatorFixture/Sub1/Packet");
+  this->m_keyChain.sign(data1, signingWithSha256());
+  VALIDATE_FAILURE(data1, "Should be rejected by the first rule");
+
+  Data data2("/Security/ValidatorFixture/Sub2/Packet");
+  this->m_keyChain.sign(data2, signingWithSha256());
+  VALIDATE_SUCCESS(data2, "Should be accepted by the second rule");
+  BOOST_CHECK_EQUAL(this->policy.m_acceptedDecisions.size(), 1);
+
+  // accepted decisions are remembered
+  VALIDATE_SUCCESS(data2, "Should be accepted by the second rule");
+  BOOST_CHECK_EQUAL(this->policy.m_acceptedDecisions.size(), 1);
+
+  Data data3("/Security/Other/Packet");
+  this->m_keyChain.sign(data3, signingWithSha256());
+  VALIDATE_FAILURE(data3, "Should not match any rule");
+
+  this->policy.load(ConfigSection{}, "<empty>");
+  BOOST_CHECK_EQUAL(this->policy.m_acceptedDecisions.size(), 0);
+  VALIDATE_FAILURE(data2, "Empty policy should reject everything");
+}
+
 BOOST_FIXTURE_TEST_CASE(DigestSha256WithKeyLocator, HierarchicalValidatorFixture<ValidationPolicyConfig>)
 {
   BOOST_CHECK_EQUAL(this->policy.m_isConfigured, false);
@@ -105,6 +105,24 @@ BOOST_AUTO_TEST_CASE(BasicV3)
   VALIDATE_FAILURE(i3, "Should fail (Sha256 signature violates policy)");
 }
 
+BOOST_AUTO_TEST_CASE(BadParametersDigest)
+{
+  auto i1 = makeSignedInterest(identity, WantAll);
+  const Block& wire = i1.wireEncode();
+  wire.parse();
+  // corrupt the last byte of ParametersSha256DigestComponent, which ends the Name element
+  Buffer buf(wire.begin(), wire.end());
+  buf[std::distance(wire.begin(), wire.elements().front().end()) - 1] ^= 0xFF;
+
+  Interest i2(Block(buf), false);
+  BOOST_CHECK_EQUAL(i2.isParametersDigestValid(), false);
+  VALIDATE_FAILURE(i2, "Should fail (digest does not match the parameters)");
+  BOOST_TEST(lastError.getCode() == ValidationError::POLICY_ERROR);
+
+  Interest i3(Block(make_span(wire.data(), wire.size())), false);
+  VALIDATE_SUCCESS(i3, "Should succeed (digest verified by the policy)");
+}
+
 BOOST_AUTO_TEST_CASE(DataPassthrough)
 {
   Data d1("/Security/ValidatorFixture/Sub1");
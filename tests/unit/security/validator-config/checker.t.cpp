@@ -73,6 +73,8 @@ public:
       auto state = PktType::makeState();
       auto result = checker.check(PktType::getType(), sigType, pktName, klName, *state);
       BOOST_CHECK_EQUAL(bool(result), expectedOutcome);
+      BOOST_CHECK_EQUAL(checker.passes(PktType::getType(), sigType, pktName, klName, *state),
+                        expectedOutcome);
       BOOST_CHECK(boost::logic::indeterminate(state->getOutcome()));
       if (!result) {
         BOOST_CHECK_NE(result.getErrorMessage(), "");
@@ -91,6 +91,15 @@ BOOST_AUTO_TEST_CASE(RegexName)
   CHECK_FOR_MATCHES(f3, false, true, false, false);
 }
 
+BOOST_AUTO_TEST_CASE(NamePrefix)
+{
+  BOOST_CHECK_EQUAL(RelationNameFilter("/foo/bar", NameRelation::EQUAL).getNamePrefix(), "/foo/bar");
+  BOOST_CHECK_EQUAL(RelationNameFilter("/foo/bar", NameRelation::IS_PREFIX_OF).getNamePrefix(), "/foo/bar");
+  BOOST_CHECK_EQUAL(RegexNameFilter(Regex("^<foo><bar><>*$")).getNamePrefix(), "/foo/bar");
+  BOOST_CHECK_EQUAL(RegexNameFilter(Regex("^<foo><bar>+$")).getNamePrefix(), "/foo");
+  BOOST_CHECK_EQUAL(RegexNameFilter(Regex("<foo><bar>")).getNamePrefix(), "/");
+}
+
 BOOST_FIXTURE_TEST_SUITE(Create, KeyChainFixture)
 
 BOOST_AUTO_TEST_CASE(Errors)
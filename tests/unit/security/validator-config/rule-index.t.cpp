@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/validator-config/rule-index.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+namespace validator_config {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Security)
+BOOST_AUTO_TEST_SUITE(ValidatorConfig)
+BOOST_AUTO_TEST_SUITE(TestRuleIndex)
+
+static unique_ptr<Rule>
+makeRule(const Name& prefix)
+{
+  auto rule = make_unique<Rule>("rule", tlv::Data);
+  if (!prefix.empty()) {
+    rule->addFilter(make_unique<RelationNameFilter>(prefix, NameRelation::IS_PREFIX_OF));
+  }
+  return rule;
+}
+
+BOOST_AUTO_TEST_CASE(Find)
+{
+  RuleIndex index;
+  BOOST_CHECK(index.find("/a/b").empty());
+
+  index.insert(*makeRule("/a/b"), 0);
+  index.insert(*makeRule("/"), 1);
+  index.insert(*makeRule("/a"), 2);
+  index.insert(*makeRule("/c"), 3);
+  index.insert(*makeRule("/a/b/c"), 4);
+  index.insert(*makeRule("/a/b"), 5);
+
+  using Positions = std::vector<size_t>;
+  BOOST_TEST(index.find("/") == Positions({1}), boost::test_tools::per_element());
+  BOOST_TEST(index.find("/a") == Positions({1, 2}), boost::test_tools::per_element());
+  BOOST_TEST(index.find("/a/b/d") == Positions({0, 1, 2, 5}), boost::test_tools::per_element());
+  BOOST_TEST(index.find("/a/b/c/d") == Positions({0, 1, 2, 4, 5}), boost::test_tools::per_element());
+  BOOST_TEST(index.find("/c") == Positions({1, 3}), boost::test_tools::per_element());
+  BOOST_TEST(index.find("/d/a/b") == Positions({1}), boost::test_tools::per_element());
+
+  index.clear();
+  BOOST_CHECK(index.find("/a/b").empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestRuleIndex
+BOOST_AUTO_TEST_SUITE_END() // ValidatorConfig
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace tests
+} // namespace validator_config
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
@@ -97,6 +97,20 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Filters, PktType, PktTypes, RuleFixture<PktType
                                      this->pktName, "/foo/bar", this->state), false);
 }
 
+BOOST_FIXTURE_TEST_CASE(NamePrefix, RuleFixture<DataPkt>)
+{
+  BOOST_CHECK_EQUAL(rule.getNamePrefix(), "/");
+
+  rule.addFilter(make_unique<RelationNameFilter>("/foo/bar/baz", NameRelation::IS_PREFIX_OF));
+  BOOST_CHECK_EQUAL(rule.getNamePrefix(), "/foo/bar/baz");
+
+  rule.addFilter(make_unique<RegexNameFilter>(Regex("^<foo><bar><qux>$")));
+  BOOST_CHECK_EQUAL(rule.getNamePrefix(), "/foo/bar");
+
+  rule.addFilter(make_unique<RegexNameFilter>(Regex("<bar>")));
+  BOOST_CHECK_EQUAL(rule.getNamePrefix(), "/");
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(Checkers, PktType, PktTypes, RuleFixture<PktType>)
 {
   auto testChecker = [this] (const Name& klName, bool expectedOutcome) {
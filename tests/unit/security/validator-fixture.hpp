@@ -164,6 +164,18 @@ private:
     // do nothing
   }
 
+  bool
+  verifyOriginalSignature(const transform::PublicKey&) const override
+  {
+    return false;
+  }
+
+  void
+  finishOriginalPacket(bool) override
+  {
+    // do nothing
+  }
+
   void
   bypassValidation() override
   {
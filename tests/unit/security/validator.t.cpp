@@ -25,6 +25,8 @@
 #include "tests/boost-test.hpp"
 #include "tests/unit/security/validator-fixture.hpp"
 
+#include <thread>
+
 namespace ndn {
 namespace security {
 inline namespace v2 {
@@ -157,6 +159,84 @@ BOOST_AUTO_TEST_CASE(TrustedCertCaching)
   face.sentInterests.clear();
 }
 
+BOOST_AUTO_TEST_CASE(PublicKeyCaching)
+{
+  const auto& keyCache = validator.getPublicKeyCache();
+  BOOST_CHECK_EQUAL(keyCache.size(), 1); // trust anchor is parsed when loaded
+  auto nHits = keyCache.getNHits();
+  auto nMisses = keyCache.getNMisses();
+
+  Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data, signingByIdentity(subIdentity));
+
+  VALIDATE_SUCCESS(data, "Should get accepted, as signed by the policy-compliant cert");
+  BOOST_CHECK_EQUAL(keyCache.getNHits(), nHits + 1); // anchor verifies the fetched cert
+  BOOST_CHECK_EQUAL(keyCache.getNMisses(), nMisses + 1); // fetched cert verifies the data
+  BOOST_CHECK_EQUAL(keyCache.size(), 2);
+
+  VALIDATE_SUCCESS(data, "Should get accepted, based on the cached trusted cert");
+  BOOST_CHECK_EQUAL(keyCache.getNHits(), nHits + 2);
+  BOOST_CHECK_EQUAL(keyCache.getNMisses(), nMisses + 1);
+
+  validator.resetVerifiedCertificates();
+  BOOST_CHECK_EQUAL(keyCache.size(), 1);
+
+  validator.resetAnchors();
+  BOOST_CHECK_EQUAL(keyCache.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(VerificationThreads)
+{
+  // populate the verified certificate cache synchronously
+  Data first("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(first, signingByIdentity(subIdentity));
+  VALIDATE_SUCCESS(first, "Should get accepted, as signed by the policy-compliant cert");
+
+  BOOST_CHECK_EQUAL(validator.getVerificationThreads(), 0);
+  validator.setVerificationThreads(m_io, 2);
+  BOOST_CHECK_EQUAL(validator.getVerificationThreads(), 2);
+
+  const size_t nPackets = 100;
+  std::vector<Data> packets;
+  for (size_t i = 0; i < nPackets; ++i) {
+    Data data(Name("/Security/ValidatorFixture/Sub1/Sub2/Data").appendSequenceNumber(i));
+    m_keyChain.sign(data, signingByIdentity(subIdentity));
+    if (i % 3 == 0) {
+      auto sig = make_shared<Buffer>(data.getSignatureValue().value_begin(),
+                                     data.getSignatureValue().value_end());
+      sig->back() ^= 0xFF;
+      data.setSignatureValue(sig);
+      data.wireEncode();
+    }
+    packets.push_back(data);
+  }
+
+  std::vector<std::pair<uint64_t, bool>> results;
+  for (const auto& data : packets) {
+    validator.validate(data,
+      [&] (const Data& d) { results.emplace_back(d.getName()[-1].toSequenceNumber(), true); },
+      [&] (const Data& d, const ValidationError&) {
+        results.emplace_back(d.getName()[-1].toSequenceNumber(), false);
+      });
+  }
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 1); // only from the first validation
+
+  for (int i = 0; i < 10000 && results.size() < nPackets; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    advanceClocks(1_ms);
+  }
+
+  BOOST_REQUIRE_EQUAL(results.size(), nPackets);
+  for (size_t i = 0; i < nPackets; ++i) {
+    BOOST_CHECK_EQUAL(results[i].first, i);
+    BOOST_CHECK_EQUAL(results[i].second, i % 3 != 0);
+  }
+
+  validator.setVerificationThreads(m_io, 0);
+  BOOST_CHECK_EQUAL(validator.getVerificationThreads(), 0);
+  VALIDATE_SUCCESS(first, "Should get accepted synchronously");
+}
+
 BOOST_AUTO_TEST_CASE(ResetVerifiedCertificates)
 {
   Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
@@ -172,6 +252,69 @@ BOOST_AUTO_TEST_CASE(ResetVerifiedCertificates)
   VALIDATE_FAILURE(data, "Should fail, as no trusted cache or anchors");
 }
 
+BOOST_AUTO_TEST_CASE(ValidationResultCaching)
+{
+  BOOST_CHECK_EQUAL(validator.getValidationResultCacheCapacity(), 0);
+  validator.setValidationResultCacheCapacity(1);
+  BOOST_CHECK_EQUAL(validator.getValidationResultCacheCapacity(), 1);
+
+  const auto& keyCache = validator.getPublicKeyCache();
+  auto getNKeyLookups = [&] { return keyCache.getNHits() + keyCache.getNMisses(); };
+
+  Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data, signingByIdentity(subIdentity));
+  Data other(data);
+  other.setContent(make_span(reinterpret_cast<const uint8_t*>("other"), 5));
+  m_keyChain.sign(other, signingByIdentity(subIdentity));
+
+  VALIDATE_SUCCESS(data, "Should get accepted, as signed by the policy-compliant cert");
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 1);
+  face.sentInterests.clear();
+  auto respond = std::move(processInterest);
+  processInterest = nullptr; // disable data responses from mocked network
+
+  auto nKeyLookups = getNKeyLookups();
+  VALIDATE_SUCCESS(data, "Should get accepted, based on the cached validation result");
+  BOOST_CHECK_EQUAL(getNKeyLookups(), nKeyLookups);
+
+  VALIDATE_SUCCESS(other, "Should get accepted, based on the cached trusted cert");
+  BOOST_CHECK_EQUAL(getNKeyLookups(), nKeyLookups + 1);
+  VALIDATE_SUCCESS(data, "Should get accepted, but evicted from the cache by the other packet");
+  BOOST_CHECK_EQUAL(getNKeyLookups(), nKeyLookups + 2);
+
+  // any change of trust anchors drops the cached results
+  validator.loadAnchor("other", Certificate(otherIdentity.getDefaultKey().getDefaultCertificate()));
+  nKeyLookups = getNKeyLookups();
+  VALIDATE_SUCCESS(data, "Should get accepted, based on the cached trusted cert");
+  BOOST_CHECK_EQUAL(getNKeyLookups(), nKeyLookups + 1);
+  VALIDATE_SUCCESS(data, "Should get accepted, based on the cached validation result");
+  BOOST_CHECK_EQUAL(getNKeyLookups(), nKeyLookups + 1);
+
+  // the result above was based on the trusted cache, so it does not outlive the cached cert
+  advanceClocks(1_h, 2); // expire trusted cache
+  VALIDATE_FAILURE(data, "Should fail, as the cached validation result has expired with the trusted cache");
+  BOOST_CHECK_GT(face.sentInterests.size(), 0);
+  face.sentInterests.clear();
+
+  // a result based on a chain that ends at a trust anchor lives until the chain expires
+  processInterest = respond;
+  advanceClocks(10_min); // expire untrusted cache
+  VALIDATE_SUCCESS(data, "Should get accepted, as the sub-certificate is fetched again");
+  face.sentInterests.clear();
+  processInterest = nullptr;
+
+  advanceClocks(1_h, 2); // expire trusted cache
+  VALIDATE_SUCCESS(data, "Should get accepted, based on the cached validation result");
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 0);
+
+  advanceClocks(91_days); // expire the sub-certificate
+  VALIDATE_FAILURE(data, "Should fail, as the cached validation result has expired");
+  face.sentInterests.clear();
+
+  validator.setValidationResultCacheCapacity(0);
+  BOOST_CHECK_EQUAL(validator.getValidationResultCacheCapacity(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(UntrustedCertCaching)
 {
   Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
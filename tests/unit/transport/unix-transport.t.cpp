@@ -20,9 +20,16 @@
  */
 
 #include "ndn-cxx/transport/unix-transport.hpp"
+#include "ndn-cxx/encoding/block-helpers.hpp"
 
 #include "tests/boost-test.hpp"
 
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/data/test_case.hpp>
+
 namespace ndn {
 namespace tests {
 
@@ -51,6 +58,143 @@ BOOST_AUTO_TEST_CASE(GetSocketNameFromUri)
                         });
 }
 
+class UnixTransportFixture
+{
+protected:
+  UnixTransportFixture()
+  {
+    boost::filesystem::create_directories(socketPath.parent_path());
+    boost::filesystem::remove(socketPath);
+    acceptor.open();
+    acceptor.bind(socketPath.string());
+    acceptor.listen();
+  }
+
+  ~UnixTransportFixture()
+  {
+    boost::filesystem::remove(socketPath);
+  }
+
+  /** \brief Run \p io until \p pred is satisfied.
+   */
+  template<typename Predicate>
+  void
+  runUntil(const Predicate& pred)
+  {
+    while (!pred()) {
+      io.run_one();
+    }
+  }
+
+protected:
+  const boost::filesystem::path socketPath{boost::filesystem::path(UNIT_TESTS_TMPDIR) /
+                                           "TestUnixTransport.sock"};
+  boost::asio::io_service io;
+  boost::asio::local::stream_protocol::acceptor acceptor{io};
+  boost::asio::local::stream_protocol::socket serverSocket{io};
+  UnixTransport transport{socketPath.string()};
+};
+
+BOOST_FIXTURE_TEST_CASE(GatherWrite, UnixTransportFixture)
+{
+  transport.connect(io, [] (const Block&) {});
+
+  // blocks sent before the connection is established are queued and then written together
+  const size_t nBlocks = 10;
+  std::vector<uint8_t> expected;
+  for (size_t i = 0; i < nBlocks; ++i) {
+    Block block = makeNonNegativeIntegerBlock(tlv::Nonce, i);
+    expected.insert(expected.end(), block.begin(), block.end());
+    transport.send(block);
+  }
+
+  std::vector<uint8_t> received(expected.size());
+  bool isReceived = false;
+  acceptor.async_accept(serverSocket, [&] (const auto& error) {
+    BOOST_REQUIRE(!error);
+    boost::asio::async_read(serverSocket, boost::asio::buffer(received), [&] (const auto& error, size_t) {
+      BOOST_CHECK(!error);
+      isReceived = true;
+    });
+  });
+  runUntil([&] { return isReceived && transport.getCounters().nOutPackets == nBlocks; });
+  transport.close();
+  io.poll();
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(received.begin(), received.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(transport.getCounters().nOutPackets, nBlocks);
+  BOOST_CHECK_EQUAL(transport.getCounters().nOutWrites, 1);
+  BOOST_CHECK_EQUAL(transport.getCounters().maxPacketsPerWrite, nBlocks);
+}
+
+BOOST_DATA_TEST_CASE_F(UnixTransportFixture, Receive, boost::unit_test::data::make({false, true}),
+                       wantZeroCopy)
+{
+  std::vector<Block> received;
+  transport.setZeroCopyReceive(wantZeroCopy);
+  BOOST_CHECK_EQUAL(transport.isZeroCopyReceive(), wantZeroCopy);
+  transport.connect(io, [&] (const Block& block) { received.push_back(block); });
+  transport.send(makeEmptyBlock(tlv::Nonce)); // connectHandler only starts receiving if there's something to send
+
+  bool isAccepted = false;
+  acceptor.async_accept(serverSocket, [&] (const auto& error) {
+    BOOST_REQUIRE(!error);
+    isAccepted = true;
+  });
+  runUntil([&] { return isAccepted && transport.isReceiving(); });
+
+  std::vector<uint8_t> wire;
+  const size_t nBlocks = 4;
+  for (size_t i = 0; i < nBlocks; ++i) {
+    Block block = makeNonNegativeIntegerBlock(tlv::Nonce, i);
+    wire.insert(wire.end(), block.begin(), block.end());
+  }
+  // the last block is split across two writes
+  boost::asio::write(serverSocket, boost::asio::buffer(wire.data(), wire.size() - 2));
+  runUntil([&] { return received.size() == nBlocks - 1; });
+  boost::asio::write(serverSocket, boost::asio::buffer(wire.data() + wire.size() - 2, 2));
+  runUntil([&] { return received.size() == nBlocks; });
+  transport.close();
+  io.poll();
+
+  for (size_t i = 0; i < nBlocks; ++i) {
+    BOOST_CHECK_EQUAL(readNonNegativeInteger(received[i]), i);
+  }
+  // in zero-copy mode, blocks received together share the same buffer
+  BOOST_CHECK_EQUAL(received[0].getBuffer() == received[1].getBuffer(), wantZeroCopy);
+}
+
+BOOST_DATA_TEST_CASE_F(UnixTransportFixture, ReceiveOversized, boost::unit_test::data::make({false, true}),
+                       wantZeroCopy)
+{
+  size_t nReceived = 0;
+  transport.setZeroCopyReceive(wantZeroCopy);
+  transport.connect(io, [&] (const Block&) { ++nReceived; });
+  transport.send(makeEmptyBlock(tlv::Nonce));
+
+  bool isAccepted = false;
+  acceptor.async_accept(serverSocket, [&] (const auto& error) {
+    BOOST_REQUIRE(!error);
+    isAccepted = true;
+  });
+  runUntil([&] { return isAccepted && transport.isReceiving(); });
+
+  // a complete TLV element that is one octet larger than MAX_NDN_PACKET_SIZE
+  std::vector<uint8_t> wire{0xfd, 0x03, 0x00, 0xfd};
+  size_t length = MAX_NDN_PACKET_SIZE - wire.size() - 2 + 1;
+  wire.push_back(static_cast<uint8_t>(length >> 8));
+  wire.push_back(static_cast<uint8_t>(length & 0xff));
+  wire.resize(MAX_NDN_PACKET_SIZE + 1);
+  boost::asio::write(serverSocket, boost::asio::buffer(wire));
+
+  BOOST_CHECK_EXCEPTION(runUntil([] { return false; }), Transport::Error,
+                        [] (const Transport::Error& error) {
+                          return error.what() == "input buffer full, but a valid TLV cannot be decoded"s;
+                        });
+  BOOST_CHECK_EQUAL(nReceived, 0);
+  BOOST_CHECK_EQUAL(transport.isConnected(), false);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestUnixTransport
 BOOST_AUTO_TEST_SUITE_END() // Transport
 
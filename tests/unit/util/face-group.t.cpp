@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/face-group.hpp"
+#include "ndn-cxx/util/dummy-client-face.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <future>
+#include <set>
+#include <thread>
+
+namespace ndn {
+namespace util {
+namespace tests {
+
+using namespace ndn::tests;
+
+class FaceGroupFixture
+{
+protected:
+  FaceGroupFixture()
+    : group(4, [] (boost::asio::io_service& io) {
+        return make_unique<DummyClientFace>(io, DummyClientFace::Options{true, false});
+      })
+  {
+  }
+
+  DummyClientFace&
+  getFace(size_t shard)
+  {
+    return static_cast<DummyClientFace&>(group.getFace(shard));
+  }
+
+  /** \brief Run \p f on the shard thread and wait for its result.
+   */
+  template<typename F>
+  auto
+  runOnShard(size_t shard, F&& f)
+  {
+    std::packaged_task<decltype(f(group.getFace(shard)))(Face&)> task(std::forward<F>(f));
+    auto result = task.get_future();
+    group.post(shard, [&task] (Face& face) { task(face); });
+    return result.get();
+  }
+
+protected:
+  FaceGroup group;
+};
+
+BOOST_AUTO_TEST_SUITE(Util)
+BOOST_FIXTURE_TEST_SUITE(TestFaceGroup, FaceGroupFixture)
+
+BOOST_AUTO_TEST_CASE(ShardIndex)
+{
+  BOOST_CHECK_EQUAL(group.size(), 4);
+
+  std::set<size_t> shards;
+  for (int i = 0; i < 100; ++i) {
+    Name name = Name("/A").appendNumber(i);
+    size_t shard = group.getShardIndex(name);
+    BOOST_CHECK_LT(shard, group.size());
+    BOOST_CHECK_EQUAL(group.getShardIndex(name), shard);
+    shards.insert(shard);
+  }
+  BOOST_CHECK_EQUAL(shards.size(), group.size());
+}
+
+BOOST_AUTO_TEST_CASE(DefaultSize)
+{
+  FaceGroup group2(0, [] (boost::asio::io_service& io) { return make_unique<DummyClientFace>(io); });
+  BOOST_CHECK_GE(group2.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ExpressInterest)
+{
+  group.start();
+
+  const size_t nInterests = 40;
+  for (size_t i = 0; i < nInterests; ++i) {
+    BOOST_CHECK(group.expressInterest(Interest(Name("/A").appendNumber(i)), nullptr, nullptr,
+                                      nullptr));
+  }
+
+  // each Interest is sent on the shard that owns its name
+  size_t nSent = 0;
+  for (size_t shard = 0; shard < group.size(); ++shard) {
+    auto sent = runOnShard(shard, [this, shard] (Face&) { return getFace(shard).sentInterests; });
+    for (const auto& interest : sent) {
+      BOOST_CHECK_EQUAL(group.getShardIndex(interest.getName()), shard);
+    }
+    nSent += sent.size();
+  }
+  BOOST_CHECK_EQUAL(nSent, nInterests);
+
+  // the callback is invoked on the owning shard thread
+  Name name = Name("/B").appendNumber(1);
+  size_t shard = group.getShardIndex(name);
+  std::promise<std::thread::id> callbackThread;
+  BOOST_CHECK(group.expressInterest(Interest(name),
+    [&] (const Interest&, const Data&) { callbackThread.set_value(std::this_thread::get_id()); },
+    nullptr, nullptr));
+  auto shardThread = runOnShard(shard, [this, shard, name] (Face&) {
+    getFace(shard).receive(*makeData(name));
+    return std::this_thread::get_id();
+  });
+  BOOST_CHECK(callbackThread.get_future().get() == shardThread);
+  BOOST_CHECK(shardThread != std::this_thread::get_id());
+
+  group.stop();
+
+  auto stats = group.getStatistics();
+  BOOST_CHECK_EQUAL(stats.nOutInterests, nInterests + 1);
+  BOOST_CHECK_EQUAL(stats.nInData, 1);
+  BOOST_CHECK_EQUAL(stats.nInNacks, 0);
+  BOOST_CHECK_EQUAL(stats.nTimeouts, 0);
+  BOOST_CHECK_EQUAL(stats.nRejectedSubmissions, 0);
+  BOOST_CHECK_EQUAL(stats.nQueuedSubmissions, 0);
+  BOOST_CHECK_EQUAL(group.getStatistics(shard).nInData, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestFaceGroup
+BOOST_AUTO_TEST_SUITE_END() // Util
+
+} // namespace tests
+} // namespace util
+} // namespace ndn
@@ -21,12 +21,16 @@
 
 #include "ndn-cxx/util/logging.hpp"
 #include "ndn-cxx/util/logger.hpp"
+#include "ndn-cxx/util/impl/buffered-log-backend.hpp"
 
 #include "tests/boost-test.hpp"
 #include "tests/unit/clock-fixture.hpp"
 
 #include <boost/test/tools/output_test_stream.hpp>
 
+#include <future>
+#include <thread>
+
 namespace ndn {
 namespace util {
 namespace tests {
@@ -162,6 +166,17 @@ NDN_LOG_MEMBER_DECL_SPECIALIZED((ClassTemplateWithLogger<int, double>));
 NDN_LOG_MEMBER_INIT_SPECIALIZED((ClassTemplateWithLogger<int, double>), ndn.util.tests.Specialized1);
 NDN_LOG_MEMBER_INIT_SPECIALIZED((ClassTemplateWithLogger<int, std::string>), ndn.util.tests.Specialized2);
 
+struct LogsWhenPrinted
+{
+};
+
+static std::ostream&
+operator<<(std::ostream& os, LogsWhenPrinted)
+{
+  NDN_LOG_FATAL("nested");
+  return os << "outer";
+}
+
 const time::microseconds LOG_SYSTIME(1468108800311239LL);
 const std::string LOG_SYSTIME_STR("1468108800.311239");
 
@@ -699,6 +714,142 @@ BOOST_AUTO_TEST_CASE(NullDestination)
   // The default Boost.Log output is still expected
 }
 
+BOOST_AUTO_TEST_SUITE(Buffered)
+
+BOOST_AUTO_TEST_CASE(ChangeDestination)
+{
+  using boost::test_tools::output_test_stream;
+
+  auto os2 = make_shared<output_test_stream>();
+  Logging::setBufferedDestination(os2);
+  Logging::setLevel("Module1", LogLevel::WARN);
+
+  logFromModule1();
+  NDN_LOG_FATAL("hex " << std::hex << 255);
+  NDN_LOG_FATAL("dec " << 255); // format flags are not carried over to the next message
+  NDN_LOG_FATAL(LogsWhenPrinted{});
+
+  Logging::flush();
+  BOOST_CHECK(os2->is_equal(
+    LOG_SYSTIME_STR + "  WARN: [Module1] warn1\n" +
+    LOG_SYSTIME_STR + " ERROR: [Module1] error1\n" +
+    LOG_SYSTIME_STR + " FATAL: [Module1] fatal1\n" +
+    LOG_SYSTIME_STR + " FATAL: [ndn.util.tests.Logging] hex ff\n" +
+    LOG_SYSTIME_STR + " FATAL: [ndn.util.tests.Logging] dec 255\n" +
+    LOG_SYSTIME_STR + " FATAL: [ndn.util.tests.Logging] nested\n" +
+    LOG_SYSTIME_STR + " FATAL: [ndn.util.tests.Logging] outer\n"
+    ));
+  BOOST_CHECK(os.is_equal(""));
+
+  weak_ptr<output_test_stream> os2weak(os2);
+  os2.reset();
+  Logging::setDestination(os, true);
+  BOOST_CHECK(os2weak.expired());
+
+  logFromModule2();
+  Logging::flush();
+  BOOST_CHECK(os.is_equal(
+    LOG_SYSTIME_STR + " FATAL: [Module2] fatal2\n"
+    ));
+}
+
+BOOST_AUTO_TEST_CASE(Threads)
+{
+  auto os2 = make_shared<std::ostringstream>();
+  Logging::setBufferedDestination(os2);
+
+  const int nThreads = 4;
+  const int nMessages = 100;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < nThreads; ++i) {
+    threads.emplace_back([i] {
+      for (int j = 0; j < nMessages; ++j) {
+        NDN_LOG_FATAL("thread " << i << " message " << j);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // switching back to Boost.Log writes out the pending messages
+  Logging::setDestination(os, true);
+
+  std::istringstream is(os2->str());
+  std::vector<int> nextMessage(nThreads, 0);
+  std::string line;
+  int nLines = 0;
+  while (std::getline(is, line)) {
+    ++nLines;
+    int thread = -1;
+    int message = -1;
+    BOOST_REQUIRE_EQUAL(std::sscanf(line.data(), "%*s FATAL: [ndn.util.tests.Logging] thread %d message %d",
+                                    &thread, &message), 2);
+    BOOST_REQUIRE(thread >= 0 && thread < nThreads);
+    BOOST_CHECK_EQUAL(message, nextMessage[thread]++); // messages of each thread stay in order
+  }
+  BOOST_CHECK_EQUAL(nLines, nThreads * nMessages);
+}
+
+BOOST_AUTO_TEST_CASE(FullBuffer)
+{
+  auto os2 = make_shared<boost::test_tools::output_test_stream>();
+  detail::BufferedLogBackend backend(64);
+  backend.setOutput(os2);
+
+  const std::string tooLong(64, 'x');
+  backend.submit(LogLevel::INFO, "Module1", tooLong.data(), tooLong.size());
+  BOOST_CHECK_EQUAL(backend.getNDropped(), 1);
+  backend.flush();
+  BOOST_CHECK(os2->is_equal("(1 log messages were dropped)\n"));
+
+  // records wrap around the end of the ring buffer
+  for (int i = 0; i < 5; ++i) {
+    const std::string message = "msg" + to_string(i);
+    backend.submit(LogLevel::DEBUG, "M", message.data(), message.size());
+    backend.flush();
+    BOOST_CHECK(os2->is_equal(LOG_SYSTIME_STR + " DEBUG: [M] " + message + "\n"));
+  }
+  BOOST_CHECK_EQUAL(backend.getNDropped(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(WakeUp)
+{
+  // notifies when the background thread flushes the output stream for the first time
+  class SyncNotifyingBuf : public std::stringbuf
+  {
+  public:
+    std::promise<void> isSynced;
+
+  protected:
+    int
+    sync() final
+    {
+      if (!m_hasSynced) {
+        m_hasSynced = true;
+        isSynced.set_value();
+      }
+      return 0;
+    }
+
+  private:
+    bool m_hasSynced = false;
+  };
+
+  SyncNotifyingBuf buf;
+  auto isSynced = buf.isSynced.get_future();
+  detail::BufferedLogBackend backend;
+  backend.setOutput(make_shared<std::ostream>(&buf));
+
+  // the idle background thread is woken up by the first record, without an explicit flush
+  const std::string message = "wake up";
+  backend.submit(LogLevel::INFO, "M", message.data(), message.size());
+  BOOST_REQUIRE(isSynced.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+  BOOST_CHECK_EQUAL(buf.str(), LOG_SYSTIME_STR + "  INFO: [M] wake up\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Buffered
+
 BOOST_AUTO_TEST_SUITE_END() // TestLogging
 BOOST_AUTO_TEST_SUITE_END() // Util
 
@@ -32,6 +32,9 @@
 
 #include "tests/boost-test.hpp"
 
+#include <atomic>
+#include <thread>
+
 namespace ndn {
 namespace tests {
 
@@ -470,6 +473,112 @@ BOOST_AUTO_TEST_CASE(TopMatcherAdvanced)
   BOOST_CHECK_EQUAL(cm->expand(), Name("/ndn/edu/ucla/yingdi/mac/"));
 }
 
+BOOST_AUTO_TEST_CASE(LiteralComponent)
+{
+  auto cm = make_shared<RegexComponentMatcher>("%00%01", make_shared<RegexBackrefManager>());
+  BOOST_CHECK_EQUAL(cm->match(Name("/%00%01"), 0), true);
+  BOOST_CHECK_EQUAL(cm->getMatchResult().size(), 1);
+  BOOST_CHECK_EQUAL(cm->match(Name("/%00%02"), 0), false);
+  BOOST_CHECK_EQUAL(cm->matchesComponent(name::Component::fromEscapedString("%00%01")), true);
+  BOOST_CHECK_EQUAL(cm->matchesComponent(name::Component::fromEscapedString("%00%01%02")), false);
+
+  // components are matched on their default URI representation, which is not unescaped
+  cm = make_shared<RegexComponentMatcher>("v=1", make_shared<RegexBackrefManager>());
+  BOOST_CHECK_EQUAL(cm->matchesComponent(name::Component::fromEscapedString("v=1")), true);
+  BOOST_CHECK_EQUAL(cm->matchesComponent(name::Component::fromEscapedString("v%3D1")), false);
+
+  cm = make_shared<RegexComponentMatcher>("", make_shared<RegexBackrefManager>());
+  BOOST_CHECK_EQUAL(cm->matchesComponent(name::Component("anything")), true);
+  cm = make_shared<RegexComponentMatcher>(".*", make_shared<RegexBackrefManager>());
+  BOOST_CHECK_EQUAL(cm->matchesComponent(name::Component()), true);
+}
+
+BOOST_AUTO_TEST_CASE(DoesMatch)
+{
+  const std::vector<string> exprs{
+    "^<a><b><c>",
+    "<b><c><d>$",
+    "^<a><b><c><d>$",
+    "<b><c>",
+    "^<a>*<b>",
+    "^<a>?<b>$",
+    "^<a>+<a><b>$",
+    "^<a>{2}<b>$",
+    "^<a>{1,2}<b>$",
+    "^<a>{2,}<b>$",
+    "^(<a>?){2}$",
+    "^(<a>*)(<a><b>)*$",
+    "^[<a><b>]*<c>$",
+    "^[^<a><b>]<c>$",
+    "^<>*<b>$",
+    "^<(.*)\\.(.*)><DNS>(<>*)<>",
+    "^(<.*>*)<.*><c>(<.*>)<.*>",
+    "<a>(<>*)<>$",
+    "^<KEY><>{1,3}$",
+    "^<v=1>",
+  };
+  const std::vector<Name> names{
+    "/", "/a", "/b", "/c", "/a/b", "/a/a/b", "/a/a/a/b", "/a/b/c", "/a/b/c/d", "/a/b/c/d/e",
+    "/a/a", "/a/b/a/b", "/a/a/b/a/b", "/b/c", "/a/c", "/d/c", "/a/b/c/c", "/n/a/b/c/d/e",
+    "/ucla.edu/DNS/yingdi/mac/ksk-1", "/KEY/1", "/KEY/1/2/3", "/KEY/1/2/3/4", "/v=1/a",
+  };
+
+  for (const auto& expr : exprs) {
+    Regex regex(expr);
+    for (const auto& name : names) {
+      BOOST_TEST_CONTEXT(expr << " " << name) {
+        BOOST_CHECK_EQUAL(regex.doesMatch(name), regex.match(name));
+      }
+    }
+  }
+
+  // doesMatch never backtracks, so pathological nested repetitions stay cheap
+  Regex nested("^((<a>*)*)*<b>$");
+  Name longName;
+  for (int i = 0; i < 64; ++i) {
+    longName.append("a");
+  }
+  BOOST_CHECK_EQUAL(nested.doesMatch(longName), false);
+  BOOST_CHECK_EQUAL(nested.doesMatch(Name(longName).append("b")), true);
+}
+
+BOOST_AUTO_TEST_CASE(DoesMatchFromThreads)
+{
+  const Regex regex("^<ndn>[<a><b>]*<(.*)\\.(.*)><KEY><>$");
+  const Name matching("/ndn/a/b/a/ucla.edu/KEY/1");
+  const Name notMatching("/ndn/a/c/ucla.edu/KEY/1");
+
+  // Boost.Test assertions are not thread-safe, so only count the results in the threads
+  std::atomic<int> nCorrect{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 500; ++i) {
+        if (regex.doesMatch(matching) && !regex.doesMatch(notMatching)) {
+          ++nCorrect;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  BOOST_CHECK_EQUAL(nCorrect, 4 * 500);
+}
+
+BOOST_AUTO_TEST_CASE(LiteralPrefix)
+{
+  BOOST_CHECK_EQUAL(Regex("^<ndn><KEY><>*$").getLiteralPrefix(), "/ndn/KEY");
+  BOOST_CHECK_EQUAL(Regex("^<ndn><edu>$").getLiteralPrefix(), "/ndn/edu");
+  BOOST_CHECK_EQUAL(Regex("^<ndn><edu>*").getLiteralPrefix(), "/ndn");
+  BOOST_CHECK_EQUAL(Regex("^<ndn><edu>{1,2}").getLiteralPrefix(), "/ndn");
+  BOOST_CHECK_EQUAL(Regex("^<ndn>(<edu>)").getLiteralPrefix(), "/ndn");
+  BOOST_CHECK_EQUAL(Regex("^<ndn>[<edu>]").getLiteralPrefix(), "/ndn");
+  BOOST_CHECK_EQUAL(Regex("^<ndn><ed.*>").getLiteralPrefix(), "/ndn");
+  BOOST_CHECK_EQUAL(Regex("^<>").getLiteralPrefix(), "/");
+  BOOST_CHECK_EQUAL(Regex("<ndn><edu>").getLiteralPrefix(), "/");
+}
+
 BOOST_AUTO_TEST_CASE(RegexBackrefManagerMemoryLeak)
 {
   auto re = make_unique<Regex>("^(<>)$");
@@ -25,54 +25,92 @@
 #include "tests/unit/io-fixture.hpp"
 
 #include <boost/lexical_cast.hpp>
+#include <boost/mpl/vector.hpp>
+
+#include <thread>
 
 namespace ndn {
 namespace scheduler {
 namespace tests {
 
+struct OrderedQueue : std::integral_constant<Scheduler::QueueType, Scheduler::QueueType::ORDERED>
+{
+};
+
+struct TimingWheelQueue : std::integral_constant<Scheduler::QueueType, Scheduler::QueueType::TIMING_WHEEL>
+{
+};
+
+using QueueTypes = boost::mpl::vector<OrderedQueue, TimingWheelQueue>;
+
+template<typename QueueType = OrderedQueue>
 class SchedulerFixture : public ndn::tests::IoFixture
 {
 protected:
-  Scheduler scheduler{m_io};
+  Scheduler scheduler{m_io, QueueType::value};
 };
 
 BOOST_AUTO_TEST_SUITE(Util)
-BOOST_FIXTURE_TEST_SUITE(TestScheduler, SchedulerFixture)
+BOOST_FIXTURE_TEST_SUITE(TestScheduler, SchedulerFixture<>)
 
 BOOST_AUTO_TEST_SUITE(General)
 
-BOOST_AUTO_TEST_CASE(Events)
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(Events, T, QueueTypes, SchedulerFixture<T>)
 {
   size_t count1 = 0;
   size_t count2 = 0;
 
-  scheduler.schedule(500_ms, [&] {
+  this->scheduler.schedule(500_ms, [&] {
     ++count1;
     BOOST_CHECK_EQUAL(count2, 1);
   });
 
-  EventId i = scheduler.schedule(1_s, [] { BOOST_ERROR("This event should not have been fired"); });
+  EventId i = this->scheduler.schedule(1_s, [] { BOOST_ERROR("This event should not have been fired"); });
   i.cancel();
 
-  scheduler.schedule(250_ms, [&] {
+  this->scheduler.schedule(250_ms, [&] {
     BOOST_CHECK_EQUAL(count1, 0);
     ++count2;
   });
 
-  i = scheduler.schedule(50_ms, [&] { BOOST_ERROR("This event should not have been fired"); });
+  i = this->scheduler.schedule(50_ms, [&] { BOOST_ERROR("This event should not have been fired"); });
   i.cancel();
 
-  advanceClocks(25_ms, 1000_ms);
+  this->advanceClocks(25_ms, 1000_ms);
   BOOST_CHECK_EQUAL(count1, 1);
   BOOST_CHECK_EQUAL(count2, 1);
 }
 
-BOOST_AUTO_TEST_CASE(CallbackException)
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SameExpiration, T, QueueTypes, SchedulerFixture<T>)
+{
+  std::vector<int> fired;
+  this->scheduler.schedule(250_ms, [&] { fired.push_back(1); });
+  this->scheduler.schedule(250_ms, [&] { fired.push_back(2); }); // runs after the previous one
+
+  this->advanceClocks(25_ms, 500_ms);
+  std::vector<int> expected{1, 2};
+  BOOST_CHECK_EQUAL_COLLECTIONS(fired.begin(), fired.end(), expected.begin(), expected.end());
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(CancelThenScheduleLater, T, QueueTypes, SchedulerFixture<T>)
+{
+  // cancelling the only event must not prevent a later event from being scheduled
+  EventId eid = this->scheduler.schedule(50_ms, [] { BOOST_ERROR("This event should not have been fired"); });
+  eid.cancel();
+
+  int count = 0;
+  this->scheduler.schedule(100_ms, [&] { ++count; });
+
+  this->advanceClocks(10_ms, 400_ms);
+  BOOST_CHECK_EQUAL(count, 1);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(CallbackException, T, QueueTypes, SchedulerFixture<T>)
 {
   class MyException : public std::exception
   {
   };
-  scheduler.schedule(10_ms, [] {
+  this->scheduler.schedule(10_ms, [] {
     // use plain 'throw' to ensure that Scheduler does not depend on the
     // internal machinery of NDN_THROW and that it can catch all exceptions
     // regardless of how they are thrown by the application
@@ -80,7 +118,7 @@ BOOST_AUTO_TEST_CASE(CallbackException)
   });
 
   bool isCallbackInvoked = false;
-  scheduler.schedule(20_ms, [&isCallbackInvoked] { isCallbackInvoked = true; });
+  this->scheduler.schedule(20_ms, [&isCallbackInvoked] { isCallbackInvoked = true; });
 
   BOOST_CHECK_THROW(this->advanceClocks(6_ms, 2), MyException);
   this->advanceClocks(6_ms, 2);
@@ -96,20 +134,35 @@ BOOST_AUTO_TEST_CASE(CancelEmptyEvent)
   BOOST_CHECK(true);
 }
 
-BOOST_AUTO_TEST_CASE(SelfCancel)
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SelfCancel, T, QueueTypes, SchedulerFixture<T>)
 {
   EventId selfEventId;
-  selfEventId = scheduler.schedule(100_ms, [&] { selfEventId.cancel(); });
-  BOOST_REQUIRE_NO_THROW(advanceClocks(100_ms, 10));
+  selfEventId = this->scheduler.schedule(100_ms, [&] { selfEventId.cancel(); });
+  BOOST_REQUIRE_NO_THROW(this->advanceClocks(100_ms, 10));
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(ScheduleFromCallback, T, QueueTypes, SchedulerFixture<T>)
+{
+  int count = 0;
+  std::function<void()> reschedule = [&] {
+    if (++count < 5) {
+      this->scheduler.schedule(0_ms, reschedule);
+    }
+  };
+  this->scheduler.schedule(0_ms, reschedule);
+
+  this->advanceClocks(1_ms, 10);
+  BOOST_CHECK_EQUAL(count, 5);
 }
 
-class SelfRescheduleFixture : public SchedulerFixture
+template<typename QueueType>
+class SelfRescheduleFixture : public SchedulerFixture<QueueType>
 {
 public:
   void
   reschedule()
   {
-    EventId eventId = scheduler.schedule(100_ms, [this] { reschedule(); });
+    EventId eventId = this->scheduler.schedule(100_ms, [this] { reschedule(); });
     selfEventId.cancel();
     selfEventId = eventId;
 
@@ -125,7 +178,7 @@ public:
     selfEventId.cancel();
 
     if (count < 5)  {
-      selfEventId = scheduler.schedule(100_ms, [this] { reschedule2(); });
+      selfEventId = this->scheduler.schedule(100_ms, [this] { reschedule2(); });
       count++;
     }
   }
@@ -135,12 +188,12 @@ public:
   {
     selfEventId.cancel();
 
-    scheduler.schedule(100_ms, [&] { ++count; });
-    scheduler.schedule(100_ms, [&] { ++count; });
-    scheduler.schedule(100_ms, [&] { ++count; });
-    scheduler.schedule(100_ms, [&] { ++count; });
-    scheduler.schedule(100_ms, [&] { ++count; });
-    scheduler.schedule(100_ms, [&] { ++count; });
+    this->scheduler.schedule(100_ms, [&] { ++count; });
+    this->scheduler.schedule(100_ms, [&] { ++count; });
+    this->scheduler.schedule(100_ms, [&] { ++count; });
+    this->scheduler.schedule(100_ms, [&] { ++count; });
+    this->scheduler.schedule(100_ms, [&] { ++count; });
+    this->scheduler.schedule(100_ms, [&] { ++count; });
   }
 
 public:
@@ -148,55 +201,56 @@ public:
   size_t count = 0;
 };
 
-BOOST_FIXTURE_TEST_CASE(Reschedule, SelfRescheduleFixture)
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(Reschedule, T, QueueTypes, SelfRescheduleFixture<T>)
 {
-  selfEventId = scheduler.schedule(0_s, [this] { reschedule(); });
-  BOOST_REQUIRE_NO_THROW(advanceClocks(50_ms, 1000_ms));
-  BOOST_CHECK_EQUAL(count, 5);
+  this->selfEventId = this->scheduler.schedule(0_s, [this] { this->reschedule(); });
+  BOOST_REQUIRE_NO_THROW(this->advanceClocks(50_ms, 1000_ms));
+  BOOST_CHECK_EQUAL(this->count, 5);
 }
 
-BOOST_FIXTURE_TEST_CASE(Reschedule2, SelfRescheduleFixture)
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(Reschedule2, T, QueueTypes, SelfRescheduleFixture<T>)
 {
-  selfEventId = scheduler.schedule(0_s, [this] { reschedule2(); });
-  BOOST_REQUIRE_NO_THROW(advanceClocks(50_ms, 1000_ms));
-  BOOST_CHECK_EQUAL(count, 5);
+  this->selfEventId = this->scheduler.schedule(0_s, [this] { this->reschedule2(); });
+  BOOST_REQUIRE_NO_THROW(this->advanceClocks(50_ms, 1000_ms));
+  BOOST_CHECK_EQUAL(this->count, 5);
 }
 
-BOOST_FIXTURE_TEST_CASE(Reschedule3, SelfRescheduleFixture)
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(Reschedule3, T, QueueTypes, SelfRescheduleFixture<T>)
 {
-  selfEventId = scheduler.schedule(0_s, [this] { reschedule3(); });
-  BOOST_REQUIRE_NO_THROW(advanceClocks(50_ms, 1000_ms));
-  BOOST_CHECK_EQUAL(count, 6);
+  this->selfEventId = this->scheduler.schedule(0_s, [this] { this->reschedule3(); });
+  BOOST_REQUIRE_NO_THROW(this->advanceClocks(50_ms, 1000_ms));
+  BOOST_CHECK_EQUAL(this->count, 6);
 }
 
-class CancelAllFixture : public SchedulerFixture
+template<typename QueueType>
+class CancelAllFixture : public SchedulerFixture<QueueType>
 {
 public:
   void
   event()
   {
     ++count;
-    scheduler.schedule(1_s, [&] { event(); });
+    this->scheduler.schedule(1_s, [&] { event(); });
   }
 
 public:
   uint32_t count = 0;
 };
 
-BOOST_FIXTURE_TEST_CASE(CancelAll, CancelAllFixture)
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(CancelAll, T, QueueTypes, CancelAllFixture<T>)
 {
-  scheduler.schedule(500_ms, [&] { scheduler.cancelAllEvents(); });
-  scheduler.schedule(1_s, [&] { event(); });
-  scheduler.schedule(3_s, [] { BOOST_ERROR("This event should have been cancelled" ); });
+  this->scheduler.schedule(500_ms, [&] { this->scheduler.cancelAllEvents(); });
+  this->scheduler.schedule(1_s, [&] { this->event(); });
+  this->scheduler.schedule(3_s, [] { BOOST_ERROR("This event should have been cancelled" ); });
 
-  advanceClocks(100_ms, 100);
-  BOOST_CHECK_EQUAL(count, 0);
+  this->advanceClocks(100_ms, 100);
+  BOOST_CHECK_EQUAL(this->count, 0);
 }
 
-BOOST_AUTO_TEST_CASE(CancelAllWithScopedEventId) // Bug 3691
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(CancelAllWithScopedEventId, T, QueueTypes, SchedulerFixture<T>) // Bug 3691
 {
-  ScopedEventId eid = scheduler.schedule(10_ms, []{});
-  scheduler.cancelAllEvents();
+  ScopedEventId eid = this->scheduler.schedule(10_ms, []{});
+  this->scheduler.cancelAllEvents();
   eid.cancel(); // should not crash
 
   // avoid "test case [...] did not check any assertions" message from Boost.Test
@@ -205,6 +259,88 @@ BOOST_AUTO_TEST_CASE(CancelAllWithScopedEventId) // Bug 3691
 
 BOOST_AUTO_TEST_SUITE_END() // General
 
+BOOST_FIXTURE_TEST_SUITE(TimingWheel, SchedulerFixture<TimingWheelQueue>)
+
+BOOST_AUTO_TEST_CASE(Granularity)
+{
+  bool isFired = false;
+  EventId eid = scheduler.schedule(1500_us, [&] { isFired = true; });
+
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(isFired, false);
+  BOOST_CHECK_EQUAL(static_cast<bool>(eid), true);
+
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(isFired, true);
+  BOOST_CHECK_EQUAL(static_cast<bool>(eid), false);
+}
+
+BOOST_AUTO_TEST_CASE(LongDelay)
+{
+  // both events hash into the same slot, but the second one is one revolution later
+  int count1 = 0;
+  int count2 = 0;
+  scheduler.schedule(1808_ms, [&] { ++count1; });
+  scheduler.schedule(10_s, [&] { ++count2; });
+
+  advanceClocks(100_ms, 9900_ms);
+  BOOST_CHECK_EQUAL(count1, 1);
+  BOOST_CHECK_EQUAL(count2, 0);
+
+  advanceClocks(100_ms, 200_ms);
+  BOOST_CHECK_EQUAL(count1, 1);
+  BOOST_CHECK_EQUAL(count2, 1);
+}
+
+BOOST_AUTO_TEST_CASE(CancelAllInSameSlot)
+{
+  int count = 0;
+  ScopedEventId eid = scheduler.schedule(10_ms, [&] { ++count; });
+  for (int i = 0; i < 1000; ++i) {
+    // a callback owning a ScopedEventId cancels a later event in the same slot when destroyed
+    auto other = make_shared<ScopedEventId>();
+    scheduler.schedule(10_ms, [other, &count] { ++count; });
+    *other = scheduler.schedule(10_ms, [&] { ++count; });
+  }
+  scheduler.cancelAllEvents();
+  eid.cancel(); // should not crash
+
+  advanceClocks(10_ms, 10);
+  BOOST_CHECK_EQUAL(count, 0);
+
+  scheduler.schedule(10_ms, [&] { ++count; });
+  advanceClocks(10_ms, 10);
+  BOOST_CHECK_EQUAL(count, 1);
+}
+
+BOOST_AUTO_TEST_CASE(ReleaseOnOtherThread)
+{
+  // fired events whose memory is released when the last EventId goes away on another thread
+  const int nEvents = 10000;
+  std::vector<EventId> eids;
+  int count = 0;
+  for (int i = 0; i < nEvents; ++i) {
+    eids.push_back(scheduler.schedule(1_ms, [&] { ++count; }));
+  }
+  advanceClocks(1_ms, 2);
+  BOOST_REQUIRE_EQUAL(count, nEvents);
+
+  std::thread releaser([eids = std::move(eids)] () mutable {
+    while (!eids.empty()) {
+      eids.pop_back();
+    }
+  });
+  for (int i = 0; i < nEvents; ++i) {
+    scheduler.schedule(1_ms, [&] { ++count; });
+  }
+  releaser.join();
+
+  advanceClocks(1_ms, 2);
+  BOOST_CHECK_EQUAL(count, 2 * nEvents);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TimingWheel
+
 BOOST_AUTO_TEST_SUITE(EventId)
 
 using scheduler::EventId;
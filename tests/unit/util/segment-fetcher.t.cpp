@@ -349,6 +349,60 @@ BOOST_AUTO_TEST_CASE(BasicInOrder)
   BOOST_CHECK_EQUAL(nAfterSegmentTimedOut, 0);
 }
 
+BOOST_AUTO_TEST_CASE(InOrderContent)
+{
+  DummyValidator acceptValidator;
+  SegmentFetcher::Options options;
+  options.inOrder = true;
+  nSegments = 401;
+
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  face.onSendInterest.connect(bind(&SegmentFetcherFixture::onInterest, this, _1));
+  fetcher->onError.connect(bind(&SegmentFetcherFixture::onError, this, _1));
+  fetcher->onInOrderComplete.connect(bind(&SegmentFetcherFixture::onInOrderComplete, this));
+
+  std::string received;
+  size_t nOnInOrderContent = 0;
+  fetcher->onInOrderContent.connect([&] (const Block& content) {
+    BOOST_CHECK_EQUAL(content.type(), tlv::Content);
+    received.append(content.value_begin(), content.value_end());
+    ++nOnInOrderContent;
+  });
+
+  face.processEvents(1_s);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nOnInOrderComplete, 1);
+  BOOST_CHECK_EQUAL(nOnInOrderContent, 401);
+  BOOST_CHECK_EQUAL(nOnInOrderData, 0);
+  BOOST_REQUIRE_EQUAL(received.size(), 14 * 401);
+  BOOST_CHECK_EQUAL(received.substr(14 * 400), std::string("Hello, world!", 14));
+  BOOST_CHECK_EQUAL(fetcher->m_segmentBuffer.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CompleteContent)
+{
+  DummyValidator acceptValidator;
+  nSegments = 401;
+
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator);
+  face.onSendInterest.connect(bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+
+  std::vector<Block> segments;
+  fetcher->onCompleteContent.connect([&] (const std::vector<Block>& s) { segments = s; });
+
+  face.processEvents(1_s);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  BOOST_CHECK_EQUAL(dataSize, 14 * 401);
+  BOOST_REQUIRE_EQUAL(segments.size(), 401);
+  for (const auto& segment : segments) {
+    BOOST_CHECK_EQUAL(segment.value_size(), 14);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(FirstSegmentNotZero)
 {
   DummyValidator acceptValidator;
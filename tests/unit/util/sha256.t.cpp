@@ -174,6 +174,25 @@ BOOST_AUTO_TEST_CASE(StaticComputeDigest)
   BOOST_TEST(*digest == *expected, boost::test_tools::per_element());
 }
 
+BOOST_AUTO_TEST_CASE(StaticComputeDigestInPlace)
+{
+  auto expected = fromHex("9f64a747e1b97f131fabb6b447296c9b6f0201e79fb3c5356e6c77e89b6a806a");
+  const uint8_t input[] = {0x01, 0x02, 0x03, 0x04};
+
+  Sha256::Digest digest;
+  Sha256::computeDigest(input, digest);
+  BOOST_TEST(digest == *expected, boost::test_tools::per_element());
+
+  digest.fill(0);
+  InputBuffers bufs{{input, 1}, {input + 1, 0}, {input + 1, 3}};
+  Sha256::computeDigest(bufs, digest);
+  BOOST_TEST(digest == *expected, boost::test_tools::per_element());
+
+  // empty input
+  Sha256::computeDigest(InputBuffers{}, digest);
+  BOOST_CHECK_EQUAL(toHex(digest), "E3B0C44298FC1C149AFBF4C8996FB92427AE41E4649B934CA495991B7852B855");
+}
+
 BOOST_AUTO_TEST_CASE(Error)
 {
   Sha256 sha;